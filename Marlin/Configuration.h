@@ -1028,6 +1028,10 @@
   // and processor overload (too many expensive sqrt calls).
   #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+  // Merge consecutive segments while the towers move in nearly straight lines,
+  // so fewer segments are planned where the delta kinematics are close to linear.
+  //#define DELTA_SEGMENT_TOLERANCE 0.002 // (mm) Maximum tower deviation from a straight line
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1816,6 +1820,22 @@
 // Enable the M48 repeatability test to test probe accuracy
 #define Z_MIN_PROBE_REPEATABILITY_TEST  // MRiscoC Enable M48 repeatability test
 
+/**
+ * M48 B benchmark mode
+ * Probe with each combination of the slow feedrates and number of probes below,
+ * time each phase of the probing, and report the fastest combination with a
+ * standard deviation within the target (M48 T, or the default below).
+ * Requires PROUI_EX, where the Z probe slow feedrate and Multiple Probing are
+ * run-time settings. The fast feedrate stays at Z_PROBE_FEEDRATE_FAST, and
+ * slow feedrates not below it are skipped.
+ */
+//#define M48_PROBE_BENCHMARK
+#if ENABLED(M48_PROBE_BENCHMARK)
+  #define M48_BENCHMARK_SLOW_FEEDRATES { Z_PROBE_FEEDRATE_FAST / 4, Z_PROBE_FEEDRATE_FAST / 2 }  // (mm/min)
+  #define M48_BENCHMARK_PROBES         { 1, 2, 3 }
+  #define M48_BENCHMARK_TARGET         0.01  // (mm) Highest standard deviation to pass
+#endif
+
 // Before deploy/stow pause for user confirmation
 //#define PAUSE_BEFORE_DEPLOY_STOW
 #if ENABLED(PAUSE_BEFORE_DEPLOY_STOW)
@@ -2236,6 +2256,8 @@
    * For Cartesian machines, instead of dividing moves on mesh boundaries,
    * split up moves into short segments like a Delta. This follows the
    * contours of the bed more closely than edge-to-edge straight moves.
+   * (Without this, UBL on Cartesian machines walks the mesh cells and follows
+   * the mesh surface with fewer segments.)
    */
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
@@ -2306,6 +2328,9 @@
   //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5 // When the nozzle is off the mesh, this value is used
                                           // as the Z-Height correction value.
 
+  //#define UBL_SEGMENT_TOLERANCE 0.002   // (mm) Cartesian moves are split on mesh lines, and within a cell
+                                          // only as much as needed to stay this close to the mesh surface.
+
   //#define UBL_MESH_WIZARD         // Run several commands in a row to get a complete mesh
 
   /**
@@ -3541,6 +3566,11 @@
 
   //#define TFT_SHARED_IO   // I/O is shared between TFT display and other devices. Disable async data transfer.
 
+  //#define TFT_DOUBLE_BUFFER   // Split the TFT buffer in two. Draw the next strip while DMA sends the last one.
+  //#define TFT_DIRTY_RECTS 32  // Remember up to this many drawn canvases and don't send unchanged ones again
+  //#define TFT_QUEUE_STATS     // Report the time, canvases, and pixels of each screen update over serial
+  //#define TFT_GLYPH_CACHE 16  // Keep this many recently drawn glyphs as ready-to-copy pixels. About 590 bytes of RAM each.
+
   #define COMPACT_MARLIN_BOOT_LOGO  // Use compressed data to save Flash space
 #endif
 
@@ -3589,6 +3619,8 @@
       #define HAS_TRAMMING_WIZARD 1
     #endif
     #define HAS_GCODE_PREVIEW 1
+    //#define PREVIEW_THUMB_CACHE 3 // Keep the thumbnails of this many files in the display SRAM (1-8). Decode them while reading the media.
+    //#define MEDIA_FILE_INDEX     // Index the G-code headers of each folder in the background, in FILEINFO.DAT. Adds M20 I.
     #define HAS_TOOLBAR 1
   #endif
   #define HAS_CUSTOM_COLORS 1
@@ -3609,6 +3641,8 @@
   //#define MEDIASORT_MENU_ITEM  // Allows enable/disable file list sorting
   #define SHOW_SPEED_IND       // Show the axes speed in mm/s intermittently with the speed percentage
   //#define NO_BLINK_IND         // Disables dashboard icon background blink indicator
+  //#define DWIN_TX_QUEUE_SIZE 512 // (bytes) Queue display commands and send them in the background. Comment out to send directly.
+  //#define DWIN_TX_STATS        // Report display bytes per frame, coalesced commands and queue stalls every 10s
 #endif
 //#define ZOFFSET_SAVE_SETTINGS // Saves settings after changing the z-offset via the menu
 //#define HAS_SD_EXTENDER 1  // Enable to support SD card extender cables
@@ -1828,6 +1828,20 @@
   //#define REMAINING_TIME_PRIME      // Provide G-code 'M75 R' to prime the Remaining Time estimate
   //#define REMAINING_TIME_AUTOPRIME  // Prime the Remaining Time estimate later (e.g., at the end of 'M109')
 
+  /**
+   * Remaining Time from a simulation of the media file
+   * While printing from media, read through the whole file in idle time, whenever the planner
+   * buffer is more than half full, and run its moves
+   * through a small model of the planner (trapezoids, junction deviation, axis limits) to
+   * build a table of print time by file position. Without 'M73 R' the Remaining Time comes
+   * from this table, scaled by the feedrate percentage. Uses about 1.3K of SRAM.
+   */
+  //#define SD_TIME_ESTIMATE
+  #if ENABLED(SD_TIME_ESTIMATE)
+    #define SD_TIME_ESTIMATE_POINTS 64  // Points in the time table (2-255)
+    #define SD_TIME_ESTIMATE_BLOCKS 16  // Moves in the lookahead of the simulation
+  #endif
+
   /**
    * Continue after Power-Loss (Creality3D)
    *
@@ -1855,6 +1869,14 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE    0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Saves rotate through this many sector-sized slots of a preallocated file,
+    // so each save rewrites one sector and never touches the FAT.
+    //#define PLR_JOURNAL_SLOTS          16
+
+    // Keep the recovery record in battery-backed SRAM (STM32F4/F7), updated on every
+    // extruding move, and write it to the SD card only on outage or pause.
+    //#define PLR_BACKUP_SRAM
+
     //#define BACKUP_POWER_SUPPLY           // Backup power / UPS to move the steppers on power-loss
     #if ENABLED(BACKUP_POWER_SUPPLY)
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
@@ -2526,7 +2548,7 @@
 #endif
 
 #if ALL(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
-  #define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
+  #define OPTIMIZED_MESH_STORAGE  // Store mesh as a base plane plus 8-bit residuals, with CRC, to save EEPROM space. PROUI_EX uses its own store.
 #endif
 
 /**
@@ -2719,6 +2741,15 @@
  */
 //#define MAXIMUM_STEPPER_RATE 250000
 
+/**
+ * Generate STEP pulses with hardware timers (STM32 only)
+ * X, Y, Z, and E0 STEP pins on a free timer channel are driven in one-pulse
+ * mode, so the Stepper ISR doesn't wait out MINIMUM_STEPPER_PULSE_NS.
+ * Pins without a free channel, dual steppers, and EDGE_STEPPING axes use GPIO.
+ * A timer that also has a heater, fan, laser, or case light pin is not used.
+ */
+//#define STEP_TIMER_PULSE
+
 // @section temperature
 
 // Control heater 0 and heater 1 in parallel.
@@ -2826,6 +2857,20 @@
 
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 #define ADVANCED_OK  // MRiscoC better management of buffer by host
+#if ENABLED(ADVANCED_OK)
+  /**
+   * Windowed ok for streaming hosts, enabled per port with 'M110 W1'.
+   * The host may keep several numbered lines in flight instead of waiting
+   * for each "ok". An "ok N<line>" acknowledges every line up to N, so oks
+   * for several lines are sent as one. After a "Resend:" the lines already
+   * in flight are dropped quietly until the requested line arrives.
+   */
+  //#define ADVANCED_OK_WINDOW
+  #if ENABLED(ADVANCED_OK_WINDOW)
+    #define ADVANCED_OK_BATCH       4 // Most lines acknowledged by one ok
+    #define ADVANCED_OK_BATCH_MS   20 // (ms) Longest delay for a held ok
+  #endif
+#endif
 
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
@@ -3610,6 +3655,14 @@
    */
   //#define TMC_DEBUG
 
+  /**
+   * Stream driver load samples with 'M921 P<ms>' for host-side monitoring.
+   * Each line has SG_RESULT/CS_ACTUAL per driver and the stepper counts:
+   *   TMC_LOAD T:<ms> X:<sg>/<cs> Y:<sg>/<cs> ... Count X:<steps> ...
+   * Every sample reads all drivers, so keep the interval reasonable on UART.
+   */
+  //#define AUTO_REPORT_TMC_LOAD
+
   /**
    * You can set your own advanced settings by filling in predefined functions.
    * A list of available functions can be found on the library github page
@@ -4142,6 +4195,17 @@
  */
 //#define STARTUP_COMMANDS "M17 Z"
 
+/**
+ * Fast boot
+ *
+ * Accept commands and start heating sooner after power-on.
+ *  - SD file sorting, the TMC connection test and the EEPROM check
+ *    run from the main loop after setup().
+ *  - ProUI skips its timed boot progress bar. With PROUI_EX the boot
+ *    screen comes from the ProUI library and is not shortened.
+ */
+//#define FAST_BOOT
+
 /**
  * G-code Macros
  *
@@ -4782,6 +4846,9 @@
 // Enable Tests that will run at startup and produce a report
 //#define MARLIN_TEST_BUILD
 
+// Report the time taken by each startup stage
+//#define BOOT_PROFILER
+
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
 
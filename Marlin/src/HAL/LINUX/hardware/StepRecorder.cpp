@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <algorithm>
+#include "StepRecorder.h"
+
+StepRecorder::StepRecorder(std::string filename, const pin_type (&step)[axis_count], const pin_type (&dir)[axis_count], const uint64_t merge_ns)
+  : merge_ns(merge_ns) {
+  for (uint8_t a = 0; a < axis_count; ++a) { step_pin[a] = step[a]; dir_pin[a] = dir[a]; }
+  file.open(filename, std::ios::binary);
+  const char header[] = { 'M', 'S', 'T', 'P', char(version), char(axis_count) };
+  file.write(header, sizeof(header));
+}
+
+StepRecorder::~StepRecorder() {
+  { std::lock_guard<std::mutex> lock(buffer_lock);
+    if (pending_bits) put_record();
+  }
+  flush();
+  file.close();
+}
+
+// Append the pending record to the buffer. Caller holds buffer_lock.
+void StepRecorder::put_record() {
+  uint64_t delta = pending_timestamp - last_timestamp;
+  last_timestamp = pending_timestamp;
+  do {
+    const uint8_t b = delta & 0x7F;
+    delta >>= 7;
+    buffer.push_back(delta ? (b | 0x80) : b);
+  } while (delta);
+  buffer.push_back(pending_bits);
+  pending_bits = 0;
+}
+
+void StepRecorder::log(GpioEvent ev) {
+  if (ev.event != GpioEvent::RISE) return;
+
+  uint8_t axis = 0;
+  while (axis < axis_count && step_pin[axis] != ev.pin_id) ++axis;
+  if (axis == axis_count) return;
+
+  std::lock_guard<std::mutex> lock(buffer_lock);
+
+  // Start a new record if this axis already stepped or the merge window has passed
+  if (pending_bits && ((pending_bits & (1 << axis)) || ev.timestamp - pending_timestamp > merge_ns))
+    put_record();
+
+  if (!pending_bits) pending_timestamp = std::max(ev.timestamp, last_timestamp); // Keep deltas positive across threads
+  pending_bits |= (1 << axis);
+  if (Gpio::get(dir_pin[axis])) pending_bits |= (0x10 << axis);
+}
+
+void StepRecorder::flush() {
+  std::vector<uint8_t> out;
+  { std::lock_guard<std::mutex> lock(buffer_lock);
+    out.swap(buffer);
+  }
+  if (out.size()) file.write((const char*)out.data(), out.size());
+  file.flush();
+}
+
+#endif // __PLAT_LINUX__
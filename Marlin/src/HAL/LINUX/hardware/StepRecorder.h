@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Compact binary recorder for STEP events, for tracing whole prints.
+ *
+ * File layout:
+ *   Header  : "MSTP", uint8 version, uint8 axis count
+ *   Records : LEB128 varint nanoseconds since the previous record, then one byte
+ *             bits 0-3 : Axes that stepped (X, Y, Z, E)
+ *             bits 4-7 : DIR pin state of each axis at the time of the step
+ *
+ * Steps on different axes closer together than merge_ns share a record.
+ * Analyze with buildroot/share/scripts/step_trace.py.
+ */
+
+#include <mutex>
+#include <vector>
+#include <fstream>
+#include "Gpio.h"
+
+class StepRecorder: public IOLogger {
+public:
+  static constexpr uint8_t axis_count = 4;
+  static constexpr uint8_t version = 1;
+
+  StepRecorder(std::string filename, const pin_type (&step)[axis_count], const pin_type (&dir)[axis_count], const uint64_t merge_ns=1000);
+  virtual ~StepRecorder();
+  void flush();
+  void log(GpioEvent ev);
+
+private:
+  void put_record();
+
+  std::ofstream file;
+  std::vector<uint8_t> buffer;
+  std::mutex buffer_lock;
+
+  pin_type step_pin[axis_count], dir_pin[axis_count];
+  uint64_t merge_ns;
+  uint64_t last_timestamp = 0, pending_timestamp = 0;
+  uint8_t pending_bits = 0;
+};
@@ -24,10 +24,12 @@
 #ifndef UNIT_TEST
 
 //#define GPIO_LOGGING // Full GPIO and Positional Logging
+//#define STEP_LOGGING // Binary STEP event trace. Analyze with buildroot/share/scripts/step_trace.py
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
+#include "hardware/StepRecorder.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
@@ -77,6 +79,11 @@ void simulation_loop() {
     position_log.open("axis_position_log.csv");
 
     int32_t x,y,z;
+  #elif defined(STEP_LOGGING)
+    const pin_type step_pins[] = { X_STEP_PIN, Y_STEP_PIN, Z_STEP_PIN, E0_STEP_PIN },
+                   dir_pins[] = { X_DIR_PIN, Y_DIR_PIN, Z_DIR_PIN, E0_DIR_PIN };
+    StepRecorder step_recorder("step_trace.bin", step_pins, dir_pins);
+    Gpio::attachLogger(&step_recorder);
   #endif
 
   for (;;) {
@@ -100,6 +107,8 @@ void simulation_loop() {
       }
       // flush the logger
       logger.flush();
+    #elif defined(STEP_LOGGING)
+      step_recorder.flush();
     #endif
 
     std::this_thread::yield();
@@ -165,6 +165,12 @@ public:
   // Free SRAM
   static int freeMemory() { return ::freeMemory(); }
 
+  #if ENABLED(PLR_BACKUP_SRAM)
+    // Battery-backed SRAM, retained through reset and power-off
+    static volatile uint8_t* backup_sram() { return (volatile uint8_t*)BKPSRAM_BASE; }
+    static constexpr size_t backup_sram_size = 0x1000; // 4KB
+  #endif
+
   //
   // ADC Methods
   //
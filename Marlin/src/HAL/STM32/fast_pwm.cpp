@@ -31,7 +31,7 @@ static uint16_t timer_freq[TIMER_NUM];
 
 void MarlinHAL::set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v_size/*=255*/, const bool invert/*=false*/) {
   const uint16_t duty = invert ? v_size - v : v;
-  if (PWM_PIN(pin)) {
+  if (PWM_PIN(pin) && !TERN0(STEP_TIMER_PULSE, HAL_step_pulse_timer_pin(pin))) {
     const PinName pin_name = digitalPinToPinName(pin);
     TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM);
 
@@ -77,6 +77,9 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   #if defined(PULSE_TIMER) && MF_TIMER_PULSE != MF_TIMER_STEP
     if (index == TIMER_INDEX(PULSE_TIMER)) return;
   #endif
+  #if ENABLED(STEP_TIMER_PULSE)
+    if (HAL_step_pulse_timer_pin(pin)) return;
+  #endif
 
   if (HardwareTimer_Handle[index] == nullptr) // If frequency is set before duty we need to create a handle here.
     HardwareTimer_Handle[index]->__this = new HardwareTimer((TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM));
@@ -323,6 +323,177 @@ static constexpr bool verify_no_timer_conflicts() {
 // when hovering over it, making it easy to identify the conflicting timers.
 static_assert(verify_no_timer_conflicts(), "One or more timer conflict detected. Examine \"timers_in_use\" to help identify conflict.");
 
+#if ENABLED(STEP_TIMER_PULSE)
+
+  AxisFlags step_pulse_axes;
+  TIM_TypeDef *step_pulse_timer[LOGICAL_AXES];
+
+  // Heater, fan, and other PWM outputs. A timer driving any of these can't make STEP pulses.
+  static constexpr pin_t pwm_output_pins[] = {
+    #if PIN_EXISTS(HEATER_0)
+      HEATER_0_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_1)
+      HEATER_1_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_2)
+      HEATER_2_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_3)
+      HEATER_3_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_4)
+      HEATER_4_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_5)
+      HEATER_5_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_6)
+      HEATER_6_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_7)
+      HEATER_7_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_BED)
+      HEATER_BED_PIN,
+    #endif
+    #if PIN_EXISTS(HEATER_CHAMBER)
+      HEATER_CHAMBER_PIN,
+    #endif
+    #if PIN_EXISTS(COOLER)
+      COOLER_PIN,
+    #endif
+    #if PIN_EXISTS(FAN0)
+      FAN0_PIN,
+    #endif
+    #if PIN_EXISTS(FAN1)
+      FAN1_PIN,
+    #endif
+    #if PIN_EXISTS(FAN2)
+      FAN2_PIN,
+    #endif
+    #if PIN_EXISTS(FAN3)
+      FAN3_PIN,
+    #endif
+    #if PIN_EXISTS(FAN4)
+      FAN4_PIN,
+    #endif
+    #if PIN_EXISTS(FAN5)
+      FAN5_PIN,
+    #endif
+    #if PIN_EXISTS(FAN6)
+      FAN6_PIN,
+    #endif
+    #if PIN_EXISTS(FAN7)
+      FAN7_PIN,
+    #endif
+    #if PIN_EXISTS(CONTROLLER_FAN)
+      CONTROLLER_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E0_AUTO_FAN)
+      E0_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E1_AUTO_FAN)
+      E1_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E2_AUTO_FAN)
+      E2_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E3_AUTO_FAN)
+      E3_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E4_AUTO_FAN)
+      E4_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E5_AUTO_FAN)
+      E5_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E6_AUTO_FAN)
+      E6_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(E7_AUTO_FAN)
+      E7_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(CHAMBER_AUTO_FAN)
+      CHAMBER_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(COOLER_AUTO_FAN)
+      COOLER_AUTO_FAN_PIN,
+    #endif
+    #if PIN_EXISTS(SPINDLE_LASER_PWM)
+      SPINDLE_LASER_PWM_PIN,
+    #endif
+    #if PIN_EXISTS(CASE_LIGHT)
+      CASE_LIGHT_PIN,
+    #endif
+    -1
+  };
+
+  // Is any PWM output on the given timer?
+  static bool timer_has_pwm_output(const TIM_TypeDef * const tim) {
+    for (const pin_t p : pwm_output_pins)
+      if (p >= 0 && PWM_PIN(p) && pinmap_peripheral(digitalPinToPinName(p), PinMap_PWM) == tim) return true;
+    return false;
+  }
+
+  // Is the pin's timer generating STEP pulses?
+  bool HAL_step_pulse_timer_pin(const pin_t pin) {
+    if (!PWM_PIN(pin)) return false;
+    const TIM_TypeDef * const tim = (TIM_TypeDef *)pinmap_peripheral(digitalPinToPinName(pin), PinMap_PWM);
+    for (uint8_t a = 0; a < LOGICAL_AXES; ++a)
+      if (step_pulse_timer[a] == tim) return true;
+    return false;
+  }
+
+  /**
+   * Put a STEP pin's timer channel into one-pulse PWM2 mode:
+   * CNT 0 is idle, CCR=1 starts the pulse, and the update event at ARR ends it
+   * and stops the counter. Return false, leaving the pin as GPIO, if the pin has
+   * no timer channel or the timer is already in use or also drives a PWM output.
+   */
+  bool HAL_step_pulse_attach(const AxisEnum axis, const pin_t pin, const bool active_state, const uint32_t pulse_ns) {
+    if (!PWM_PIN(pin)) return false;
+
+    const PinName pin_name = digitalPinToPinName(pin);
+    const uint32_t function = pinmap_function(pin_name, PinMap_PWM);
+    if (STM_PIN_INVERTED(function)) return false;           // Complementary outputs are not supported
+
+    TIM_TypeDef * const tim = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM);
+    const int timer_num = get_timer_num_from_base_address(uintptr_t(tim));
+    for (const auto &t : timers_in_use) if (t.t == timer_num) return false;
+    if (HardwareTimer_Handle[get_timer_index(tim)] != nullptr) return false; // Claimed for PWM or by another STEP pin
+    if (timer_has_pwm_output(tim)) return false;           // Needed for a heater, fan, etc.
+
+    HardwareTimer * const HT = new HardwareTimer(tim);
+    const uint32_t channel = STM_PIN_CHANNEL(function);
+
+    // Pulse width in timer ticks, rounded up
+    HT->setPrescaleFactor(1);
+    uint32_t ticks = uint32_t((uint64_t(HT->getTimerClkFreq()) * pulse_ns + 999999999ULL) / 1000000000ULL);
+    LIMIT(ticks, 1U, HAL_TIMER_TYPE_MAX - 1U);
+
+    HT->setPreloadEnable(false);
+    HT->setMode(channel, TIMER_OUTPUT_COMPARE_PWM2, pin);
+    HT->setOverflow(ticks + 1, TICK_FORMAT);                // ARR = ticks
+    HT->setCaptureCompare(channel, ticks + 1, TICK_COMPARE_FORMAT); // Past ARR, so the first run is silent
+    LL_TIM_SetOnePulseMode(tim, LL_TIM_ONEPULSEMODE_SINGLE);
+
+    if (active_state == LOW) {
+      static constexpr uint32_t ll_channel[] = { LL_TIM_CHANNEL_CH1, LL_TIM_CHANNEL_CH2, LL_TIM_CHANNEL_CH3, LL_TIM_CHANNEL_CH4 };
+      LL_TIM_OC_SetPolarity(tim, ll_channel[channel - 1], LL_TIM_OCPOLARITY_LOW);
+    }
+
+    HT->resume();                                           // Enable the channel output
+    while (tim->CR1 & TIM_CR1_CEN) { /* wait for the silent run to end */ }
+    HT->setCaptureCompare(channel, 1, TICK_COMPARE_FORMAT);
+
+    step_pulse_timer[axis] = tim;
+    step_pulse_axes.set(axis);
+    return true;
+  }
+
+#endif // STEP_TIMER_PULSE
+
 // Support for Creality CV Laser module
 // Code from CrealityOfficial laser support repository:
 // https://github.com/CrealityOfficial/Ender-3S1/tree/ender-3s1-lasermodel
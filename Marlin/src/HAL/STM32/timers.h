@@ -124,6 +124,33 @@ FORCE_INLINE static void HAL_timer_set_compare(const uint8_t timer_num, const ha
 inline void HAL_timer_isr_prologue(const uint8_t) {}
 inline void HAL_timer_isr_epilogue(const uint8_t) {}
 
+#if ENABLED(STEP_TIMER_PULSE)
+
+  /**
+   * Hardware STEP pulses. A STEP pin attached to its timer channel is driven in
+   * one-pulse mode, so starting a pulse is a single register write and the pulse
+   * ends on its own without the Stepper ISR having to wait for it.
+   */
+  extern AxisFlags step_pulse_axes;                   // Axes with a timer-driven STEP pin
+  extern TIM_TypeDef *step_pulse_timer[LOGICAL_AXES];
+
+  bool HAL_step_pulse_attach(const AxisEnum axis, const pin_t pin, const bool active_state, const uint32_t pulse_ns);
+  bool HAL_step_pulse_timer_pin(const pin_t pin);    // Is the pin's timer generating STEP pulses?
+
+  FORCE_INLINE static void HAL_step_pulse_start(const AxisEnum axis) {
+    TIM_TypeDef * const tim = step_pulse_timer[axis];
+    while (tim->CR1 & TIM_CR1_CEN) { /* previous pulse still running */ }
+    tim->CR1 |= TIM_CR1_CEN;
+  }
+
+  // Replaces WRITE(STEP_PIN, STATE). Only the active edge matters for an attached pin.
+  #define HAL_STEP_PULSE_WRITE(A, PIN, STATE, ACTIVE) do{ \
+    if (step_pulse_axes.test(A)) { if ((STATE) == (ACTIVE)) HAL_step_pulse_start(A); } \
+    else WRITE(PIN, STATE); \
+  }while(0)
+
+#endif
+
 // Support for Creality CV Laser module
 // Code from CrealityOfficial laser support repository:
 // https://github.com/CrealityOfficial/Ender-3S1/tree/ender-3s1-lasermodel
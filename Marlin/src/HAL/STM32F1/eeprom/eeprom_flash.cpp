@@ -44,7 +44,10 @@
 size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
 
 static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
-static bool eeprom_dirty = false;
+
+// Pages holding changed data. Only these are erased and rewritten.
+#define EEPROM_PAGES CEILING(MARLIN_EEPROM_SIZE, EEPROM_PAGE_SIZE)
+static Flags<EEPROM_PAGES> dirty_pages;
 
 bool PersistentStore::access_start() {
   const uint32_t *src = reinterpret_cast<const uint32_t*>(EEPROM_PAGE0_BASE);
@@ -56,34 +59,29 @@ bool PersistentStore::access_start() {
   for (size_t i = 0; i < eeprom_size_u32; ++i, ++dst, ++src)
     *dst = *src;
 
-  eeprom_dirty = false;
+  dirty_pages.reset();
   return true;
 }
 
 bool PersistentStore::access_finish() {
 
-  if (eeprom_dirty) {
-    FLASH_Status status;
-
-    // Instead of erasing all (both) pages, maybe in the loop we check what page we are in, and if the
-    // data has changed in that page. We then erase the first time we "detect" a change. In theory, if
-    // nothing changed in a page, we wouldn't need to erase/write it.
-    // Or, instead of checking at this point, turn eeprom_dirty into an array of bool the size of number
-    // of pages. Inside write_data, we set the flag to true at that time if something in that
-    // page changes...either way, something to look at later.
+  if (dirty_pages) {
     FLASH_Unlock();
 
-    #define ACCESS_FINISHED(TF) { FLASH_Lock(); eeprom_dirty = false; return TF; }
+    #define ACCESS_FINISHED(TF) { FLASH_Lock(); dirty_pages.reset(); return TF; }
+
+    for (uint8_t page = 0; page < EEPROM_PAGES; ++page) {
+      if (!dirty_pages[page]) continue;
 
-    status = FLASH_ErasePage(EEPROM_PAGE0_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
-    status = FLASH_ErasePage(EEPROM_PAGE1_BASE);
-    if (status != FLASH_COMPLETE) ACCESS_FINISHED(true);
+      const uint32_t base = EEPROM_PAGE0_BASE + page * (EEPROM_PAGE_SIZE);
+      if (FLASH_ErasePage(base) != FLASH_COMPLETE) ACCESS_FINISHED(true);
 
-    const uint16_t *src = reinterpret_cast<const uint16_t*>(ram_eeprom);
-    for (size_t i = 0; i < long(MARLIN_EEPROM_SIZE); i += 2, ++src) {
-      if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *src) != FLASH_COMPLETE)
-        ACCESS_FINISHED(false);
+      const size_t start = page * (EEPROM_PAGE_SIZE),
+                   end = _MIN(size_t(MARLIN_EEPROM_SIZE), start + (EEPROM_PAGE_SIZE));
+      const uint16_t *src = reinterpret_cast<const uint16_t*>(ram_eeprom + start);
+      for (size_t i = start; i < end; i += 2, ++src)
+        if (FLASH_ProgramHalfWord(EEPROM_PAGE0_BASE + i, *src) != FLASH_COMPLETE)
+          ACCESS_FINISHED(false);
     }
 
     ACCESS_FINISHED(true);
@@ -93,8 +91,13 @@ bool PersistentStore::access_finish() {
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; ++i) ram_eeprom[pos + i] = value[i];
-  eeprom_dirty = true;
+  for (size_t i = 0; i < size; ++i) {
+    const int p = pos + i;
+    if (ram_eeprom[p] != value[i]) {
+      ram_eeprom[p] = value[i];
+      dirty_pages.set(p / (EEPROM_PAGE_SIZE));
+    }
+  }
   crc16(crc, value, size);
   pos += size;
   return false;  // return true for any error
@@ -188,6 +188,10 @@
   #include "feature/cancel_object.h"
 #endif
 
+#if ENABLED(SD_TIME_ESTIMATE)
+  #include "feature/time_estimate.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "feature/runout.h"
 #endif
@@ -371,7 +375,10 @@ bool Marlin::printingIsPaused() {
 void Marlin::startOrResumeJob() {
   if (!printingIsPaused()) {
     TERN_(GCODE_REPEAT_MARKERS, repeat.reset());
-    TERN_(CANCEL_OBJECTS, cancelable.reset());
+    #if ENABLED(CANCEL_OBJECTS)
+      cancelable.reset();
+      TERN_(HAS_MEDIA, cancelable.reset_ingest());
+    #endif
     TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator = 0);
     TERN_(SET_REMAINING_TIME, ui.reset_remaining_time());
     TERN_(HAS_PRUSA_MMU3, MMU3::operation_statistics.reset_per_print_stats());
@@ -836,9 +843,15 @@ void Marlin::idle(const bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(HAS_MEDIA, card.manage_media());
 
+  // Simulate the printing file for the Remaining Time
+  TERN_(SD_TIME_ESTIMATE, timeEstimate.idle());
+
   // Announce Host Keepalive state (if any)
   TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
 
+  // Acknowledge batched lines that have waited too long
+  TERN_(ADVANCED_OK_WINDOW, queue.send_stale_oks());
+
   // Update the Print Job Timer state
   TERN_(PRINTCOUNTER, print_job_timer.tick());
 
@@ -876,6 +889,7 @@ void Marlin::idle(const bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(AUTO_REPORT_TMC_LOAD, tmc_load_auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
     }
   #endif
@@ -1074,6 +1088,64 @@ inline void tmc_standby_setup() {
   #endif
 } // tmc_standby_setup()
 
+#if ENABLED(BOOT_PROFILER)
+  // Report the time taken by one startup stage
+  static void log_boot_stage(PGM_P const name, const millis_t start_ms) {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM_P(name);
+    SERIAL_ECHOLNPGM(" : ", millis() - start_ms, "ms");
+  }
+#endif
+
+#if ENABLED(IIC_BL24CXX_EEPROM)
+  static void bl24cxx_check() {
+    BL24CXX::init();
+    const uint8_t err = BL24CXX::check();
+    SERIAL_ECHO_TERNARY(err, "BL24CXX Check ", "failed", "succeeded", "!\n");
+  }
+#endif
+
+#if ENABLED(FAST_BOOT)
+
+  /**
+   * Startup work that doesn't have to hold up the first command.
+   * Called from the main loop, running one stage per pass until done.
+   */
+  static void finish_setup() {
+    static uint8_t stage = 0;
+    #if ENABLED(BOOT_PROFILER)
+      #define BOOT_STAGE(C) do{ const millis_t ms = millis(); C; log_boot_stage(PSTR(STRINGIFY(C)), ms); }while(0)
+    #else
+      #define BOOT_STAGE(C) C
+    #endif
+    switch (stage) {
+      case 0:
+        #if ALL(HAS_MEDIA, SDCARD_SORT_ALPHA)
+          if (card.isMounted()) BOOT_STAGE(card.presort());
+        #endif
+        break;
+      case 1:
+        #if ENABLED(IIC_BL24CXX_EEPROM)
+          BOOT_STAGE(bl24cxx_check());
+        #endif
+        break;
+      case 2:
+        #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
+          BOOT_STAGE(test_tmc_connection());
+        #endif
+        break;
+      case 3:
+        #if ENABLED(BOOT_PROFILER)
+          SERIAL_ECHO_MSG("Startup completed in ", millis(), "ms");
+        #endif
+        break;
+      default: return;
+    }
+    ++stage;
+  }
+
+#endif // FAST_BOOT
+
 /**
  * Marlin Firmware entry-point. Abandon Hope All Ye Who Enter Here.
  * Setup before the program loop:
@@ -1186,7 +1258,11 @@ void setup() {
   #else
     #define SETUP_LOG(...) NOOP
   #endif
-  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
+  #if ENABLED(BOOT_PROFILER)
+    #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); const millis_t ms = millis(); C; log_boot_stage(PSTR(STRINGIFY(C)), ms); }while(0)
+  #else
+    #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
+  #endif
 
   MYSERIAL1.begin(BAUDRATE);
   millis_t serial_connect_timeout = millis() + 1000UL;
@@ -1651,10 +1727,8 @@ void setup() {
     SETUP_RUN(mmu2.init());
   #endif
 
-  #if ENABLED(IIC_BL24CXX_EEPROM)
-    BL24CXX::init();
-    const uint8_t err = BL24CXX::check();
-    SERIAL_ECHO_TERNARY(err, "BL24CXX Check ", "failed", "succeeded", "!\n");
+  #if ENABLED(IIC_BL24CXX_EEPROM) && DISABLED(FAST_BOOT)
+    SETUP_RUN(bl24cxx_check());
   #endif
 
   #if ENABLED(DWIN_CREALITY_LCD)
@@ -1710,7 +1784,7 @@ void setup() {
     SETUP_RUN(easythreed_ui.init());
   #endif
 
-  #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
+  #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF) && DISABLED(FAST_BOOT)
     SETUP_RUN(test_tmc_connection());
   #endif
 
@@ -1735,6 +1809,9 @@ void setup() {
   #endif
 
   SETUP_LOG("setup() completed.");
+  #if ENABLED(BOOT_PROFILER)
+    SERIAL_ECHO_MSG("setup() completed in ", millis(), "ms");
+  #endif
 
   TERN_(MARLIN_TEST_BUILD, runStartupTests());
 } // setup()
@@ -1763,6 +1840,8 @@ void loop() {
 
     queue.advance();
 
+    TERN_(FAST_BOOT, finish_setup());
+
     #if ANY(POWER_OFF_TIMER, POWER_OFF_WAIT_FOR_COOLDOWN)
       powerManager.checkAutoPowerOff();
     #endif
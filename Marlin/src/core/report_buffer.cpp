@@ -0,0 +1,117 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "report_buffer.h"
+
+/**
+ * Measure the static text around each '%' field of the template.
+ * A '%' beyond REPORT_TEMPLATE_FIELDS is kept as plain text.
+ */
+void ReportTemplate::index() {
+  uint8_t f = 0, n = 0;
+  for (PGM_P p = text;; ++p) {
+    const char c = pgm_read_byte(p);
+    if (!c) break;
+    if (c == '%' && f < REPORT_TEMPLATE_FIELDS) { run[f++] = n; n = 0; }
+    else ++n;
+  }
+  run[f] = n;
+  fields = f;
+}
+
+/**
+ * Convert a float to text with integer math. Only the fractional part is
+ * scaled and rounded, so no precision is lost to the whole part. The output
+ * matches the serial print(value, prec), including "-0.00" for tiny negative values.
+ */
+uint8_t report_ftoa(char *out, float value, uint8_t prec) {
+  char * const start = out;
+
+  if (value != value) { out[0] = 'n'; out[1] = 'a'; out[2] = 'n'; return 3; }
+  if (value < 0) { *out++ = '-'; value = -value; }
+
+  NOMORE(prec, 6);
+  uint32_t scale = 1;
+  for (uint8_t i = prec; i--;) scale *= 10;
+  uint32_t whole, frac = 0;
+  if (value < 4294967040.0f) {
+    whole = uint32_t(value);
+    frac = uint32_t((value - whole) * scale + 0.5f);
+    if (frac >= scale) { frac -= scale; ++whole; }
+  }
+  else
+    whole = UINT32_MAX;
+
+  char tmp[10];
+  uint8_t n = 0;
+  do { tmp[n++] = '0' + whole % 10; whole /= 10; } while (whole);
+  while (n) *out++ = tmp[--n];
+
+  if (prec) {
+    *out++ = '.';
+    for (uint8_t i = prec; i--;) { out[i] = '0' + frac % 10; frac /= 10; }
+    out += prec;
+  }
+  return out - start;
+}
+
+ReportBuffer& ReportBuffer::send() {
+  if (len) SERIAL_WRITE(buf, len);
+  len = 0;
+  return *this;
+}
+
+ReportBuffer& ReportBuffer::add(const char *s) {
+  while (*s) add(*s++);
+  return *this;
+}
+
+ReportBuffer& ReportBuffer::add_run_P(PGM_P p, uint16_t n) {
+  while (n) {
+    if (len == REPORT_BUFFER_SIZE) send();
+    const uint16_t c = _MIN(n, uint16_t(REPORT_BUFFER_SIZE - len));
+    memcpy_P(&buf[len], p, c);
+    len += c; p += c; n -= c;
+  }
+  return *this;
+}
+
+ReportBuffer& ReportBuffer::add_uint(uint32_t v) {
+  char tmp[10];
+  uint8_t n = 0;
+  do { tmp[n++] = '0' + v % 10; v /= 10; } while (v);
+  reserve(n);
+  while (n) buf[len++] = tmp[--n];
+  return *this;
+}
+
+ReportBuffer& ReportBuffer::add_int(const int32_t v) {
+  if (v >= 0) return add_uint(v);
+  add('-');
+  return add_uint(uint32_t(-(v + 1)) + 1);
+}
+
+ReportBuffer& ReportBuffer::add_float(const float v, const uint8_t prec) {
+  reserve(20);
+  len += report_ftoa(&buf[len], v, prec);
+  return *this;
+}
@@ -0,0 +1,132 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * report_buffer.h - Build a status report in RAM and send it with one serial write
+ *
+ * Periodic reports (M105, M114, M27 and their auto-reports) are made of many short
+ * labels and numbers. Printed piecewise each piece goes through the serial stack on
+ * its own, and every float goes through print(). A ReportBuffer collects the whole
+ * line, formats numbers with integer math, and hands the result to the serial port
+ * in a single write. If a report outgrows the buffer it is sent in several writes.
+ *
+ *   ReportBuffer rb;
+ *   rb.add(F("T:"), p_float_t(temp, 2)).add(F(" /"), target).eol().send();
+ *
+ * A ReportTemplate holds the static text of a report as one PROGMEM string with a
+ * '%' in place of each value. The text runs between fields are measured on first
+ * use, so later reports copy each run with a single memcpy_P.
+ *
+ *   static ReportTemplate tpl(PSTR("X:% Y:% Z:%"));
+ *   rb.fill(tpl, pos.x, pos.y, pos.z);
+ */
+
+#include "serial.h"
+
+#ifndef REPORT_BUFFER_SIZE
+  #ifdef __AVR__
+    #define REPORT_BUFFER_SIZE 96
+  #else
+    #define REPORT_BUFFER_SIZE 192
+  #endif
+#endif
+
+#ifndef REPORT_TEMPLATE_FIELDS
+  #define REPORT_TEMPLATE_FIELDS 20
+#endif
+
+class ReportTemplate {
+public:
+  PGM_P const text;
+  uint8_t fields = 0xFF;                        // Number of '%' fields. 0xFF until indexed.
+  uint8_t run[REPORT_TEMPLATE_FIELDS + 1];      // Length of the static text before each field, and after the last
+
+  ReportTemplate(PGM_P const t) : text(t) {}
+  void index();
+};
+
+class ReportBuffer {
+  char buf[REPORT_BUFFER_SIZE + 1];
+  uint16_t len = 0;
+
+  // Make room for 'n' more characters, sending what's buffered if needed
+  void reserve(const uint16_t n) { if (len + n > REPORT_BUFFER_SIZE) send(); }
+
+  ReportBuffer& add_int(const int32_t v);
+  ReportBuffer& add_uint(uint32_t v);
+  ReportBuffer& add_float(const float v, const uint8_t prec);
+  ReportBuffer& add_run_P(PGM_P p, uint16_t n);
+
+  // Add the values to a template, one field at a time
+  void fill_fields(const ReportTemplate &t, PGM_P p, const uint8_t f) {
+    add_run_P(p, t.run[_MIN(f, t.fields)]);     // Trailing text
+  }
+  template<typename T, typename... Args>
+  void fill_fields(const ReportTemplate &t, PGM_P p, const uint8_t f, const T v, Args... more) {
+    if (f >= t.fields) return fill_fields(t, p, f);
+    add_run_P(p, t.run[f]);
+    add(v);
+    fill_fields(t, p + t.run[f] + 1, f + 1, more...);
+  }
+
+public:
+  uint16_t length() const { return len; }
+  const char* str() { buf[len] = '\0'; return buf; }
+
+  // Write the buffer to the serial port(s) and empty it
+  ReportBuffer& send();
+  // Empty the buffer without sending it
+  ReportBuffer& clear() { len = 0; return *this; }
+
+  ReportBuffer& add(const char c)               { reserve(1); buf[len++] = c; return *this; }
+  ReportBuffer& add(const serial_char_t v)      { return add(char(v.c)); }
+  ReportBuffer& add(const char *s);
+  ReportBuffer& add_P(PGM_P const p)            { return add_run_P(p, strlen_P(p)); }
+  ReportBuffer& add(FSTR_P const f)             { return add_P(FTOP(f)); }
+  ReportBuffer& add(const bool b)               { return add(b ? F("true") : F("false")); }
+  ReportBuffer& add(const int8_t v)             { return add_int(v); }
+  ReportBuffer& add(const short v)              { return add_int(v); }
+  ReportBuffer& add(const int v)                { return add_int(v); }
+  ReportBuffer& add(const long v)               { return add_int(v); }
+  ReportBuffer& add(const unsigned char v)      { return add_uint(v); }
+  ReportBuffer& add(const unsigned short v)     { return add_uint(v); }
+  ReportBuffer& add(const unsigned int v)       { return add_uint(v); }
+  ReportBuffer& add(const unsigned long v)      { return add_uint(v); }
+  ReportBuffer& add(const float v)              { return add_float(v, SERIAL_FLOAT_PRECISION); }
+  ReportBuffer& add(const p_float_t v)          { return add_float(v.value, v.prec); }
+  ReportBuffer& eol()                           { return add('\n'); }
+
+  template<typename T, typename... Args>
+  ReportBuffer& add(const T v, Args... more)    { add(v); return add(more...); }
+
+  // Add the static text of a template with the given values in its fields
+  template<typename... Args>
+  ReportBuffer& fill(ReportTemplate &t, Args... values) {
+    if (t.fields == 0xFF) t.index();
+    fill_fields(t, t.text, 0, values...);
+    return *this;
+  }
+};
+
+// Format a float with a fixed number of decimals. Same result as print(value, prec).
+uint8_t report_ftoa(char *out, float value, uint8_t prec);
@@ -85,6 +85,8 @@ void SERIAL_EOL() { SERIAL_CHAR('\n'); }
 
 void SERIAL_ECHO(serial_char_t x) { SERIAL_IMPL.write(x.c); }
 
+void SERIAL_WRITE(const char *buf, const size_t len) { serial_write_block(SERIAL_IMPL, (const uint8_t*)buf, len, 0); }
+
 void SERIAL_FLUSH()    { SERIAL_IMPL.flush(); }
 void SERIAL_FLUSHTX()  { SERIAL_IMPL.flushTX(); }
 
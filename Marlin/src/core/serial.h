@@ -149,6 +149,9 @@ void SERIAL_ECHO(serial_char_t x);
 template <typename T> void SERIAL_PRINT(T x, PrintBase y)   { SERIAL_IMPL.print(x, y); }
 template <typename T> void SERIAL_PRINTLN(T x, PrintBase y) { SERIAL_IMPL.println(x, y); }
 
+// Write a block of characters with one call to the serial port(s)
+void SERIAL_WRITE(const char *buf, const size_t len);
+
 // Flush the serial port
 void SERIAL_FLUSH();
 void SERIAL_FLUSHTX();
@@ -50,6 +50,12 @@ public:
   static constexpr uint8_t All = 0xFF;
 };
 
+// Write a block with the port's own block write if it has one, otherwise one character at a time
+template <class SerialT>
+inline auto serial_write_block(SerialT &s, const uint8_t *buffer, size_t size, int) -> decltype(s.write(buffer, size), void()) { s.write(buffer, size); }
+template <class SerialT>
+inline void serial_write_block(SerialT &s, const uint8_t *buffer, size_t size, long) { while (size--) s.write(*buffer++); }
+
 // The most basic serial class: it dispatch to the base serial class with no hook whatsoever. This will compile to nothing but the base serial class
 template <class SerialT>
 struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
@@ -228,6 +234,12 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     REPEAT(NUM_SERIAL, _S_WRITE);
     #undef _S_WRITE
   }
+  // Write a block to each enabled port, checking the mask once per port
+  NO_INLINE void write(const uint8_t *buffer, size_t size) {
+    #define _S_WRITE(N) if (portMask.enabled(output[N])) serial_write_block(serial##N, buffer, size, 0);
+    REPEAT(NUM_SERIAL, _S_WRITE);
+    #undef _S_WRITE
+  }
   NO_INLINE void msgDone() {
     #define _S_DONE(N) if (portMask.enabled(output[N])) serial##N.msgDone();
     REPEAT(NUM_SERIAL, _S_DONE);
@@ -163,7 +163,7 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     if (!_z_values) {
       SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
-      print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, [](const uint8_t x, const uint8_t y) { return virt_z(x, y); });
     }
   #endif
 }
@@ -172,7 +172,7 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
   #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
-  float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  int16_t LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
   xy_pos_t LevelingBilinear::grid_spacing_virt;
   xy_float_t LevelingBilinear::grid_factor_virt;
 
@@ -252,7 +252,7 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
             if ((ty && y == (GRID_MAX_POINTS_Y) - 1) || (tx && x == (GRID_MAX_POINTS_X) - 1))
               continue;
             z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
-              virt_2cmr(x + 1, y + 1, (float)tx / (BILINEAR_SUBDIVISIONS), (float)ty / (BILINEAR_SUBDIVISIONS));
+              virt_to_um(virt_2cmr(x + 1, y + 1, (float)tx / (BILINEAR_SUBDIVISIONS), (float)ty / (BILINEAR_SUBDIVISIONS)));
           }
   }
 
@@ -271,6 +271,8 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_POINTS_X   ABL_GRID_POINTS_VIRT_X
   #define ABL_BG_POINTS_Y   ABL_GRID_POINTS_VIRT_Y
   #define ABL_BG_GRID(X,Y)  z_values_virt[X][Y]
+  #define ABL_BG_FRAC_BITS  12                  // Ratios within a cell in 1/4096ths
+  #define ABL_BG_FRAC(R)    LROUND((R) * float(_BV32(ABL_BG_FRAC_BITS)))
 #else
   #define ABL_BG_SPACING(A) grid_spacing.A
   #define ABL_BG_FACTOR(A)  grid_factor.A
@@ -282,7 +284,14 @@ void LevelingBilinear::refresh_bed_level() {
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  static float z1, d2, z3, d4, L, D;
+  #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+    // Interpolate the micrometer mesh with integer math
+    static int32_t z1, d2, z3, d4, L, D;
+    static xy_long_t fratio;
+    static bool cell_is_nan;
+  #else
+    static float z1, d2, z3, d4, L, D;
+  #endif
 
   static xy_pos_t ratio;
 
@@ -311,6 +320,7 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
     thisg.x = gx;
     nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+    TERN_(ABL_BILINEAR_SUBDIVISION, fratio.x = ABL_BG_FRAC(ratio.x));
   }
 
   if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
@@ -328,6 +338,7 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
       thisg.y = gy;
       nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      TERN_(ABL_BILINEAR_SUBDIVISION, fratio.y = ABL_BG_FRAC(ratio.y));
     }
 
     if (cached_g != thisg) {
@@ -337,16 +348,31 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
       d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
       z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
       d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+        cell_is_nan = z1 == ABL_VIRT_NAN || z3 == ABL_VIRT_NAN
+                   || ABL_BG_GRID(thisg.x, nextg.y) == ABL_VIRT_NAN || ABL_BG_GRID(nextg.x, nextg.y) == ABL_VIRT_NAN;
+      #endif
     }
 
     // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+                  L = z1 + ((d2 * fratio.y) >> ABL_BG_FRAC_BITS);   // Linear interp. LF -> LB (um)
+      const int32_t R = z3 + ((d4 * fratio.y) >> ABL_BG_FRAC_BITS); // Linear interp. RF -> RB (um)
+    #else
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+    #endif
 
     D = R - L;
   }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+  #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+    // Only the result is converted to mm
+    if (cell_is_nan) return NAN;
+    const float offset = float(L * int32_t(_BV32(ABL_BG_FRAC_BITS)) + D * fratio.x) * (0.001f / _BV32(ABL_BG_FRAC_BITS));
+  #else
+    const float offset = L + ratio.x * D;   // the offset almost always changes
+  #endif
 
   /*
   static float last_offset = 0;
@@ -44,10 +44,20 @@ private:
       #define ABL_GRID_POINTS_VIRT_Y (GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) + 1)
     #endif
 
-    static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    // The subdivided mesh is stored in micrometers to halve its RAM usage
+    #define ABL_VIRT_NAN INT16_MIN
+    static int16_t z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
     static xy_pos_t grid_spacing_virt;
     static xy_float_t grid_factor_virt;
 
+    static int16_t virt_to_um(const float z) {
+      return isnan(z) ? ABL_VIRT_NAN : int16_t(constrain(LROUND(z * 1000.0f), INT16_MIN + 1, INT16_MAX));
+    }
+    static float virt_z(const uint8_t x, const uint8_t y) {
+      const int16_t um = z_values_virt[x][y];
+      return um == ABL_VIRT_NAN ? NAN : um * 0.001f;
+    }
+
     static float virt_coord(const uint8_t x, const uint8_t y);
     static float virt_cmr(const float p[4], const uint8_t i, const float t);
     static float virt_2cmr(const uint8_t x, const uint8_t y, const float tx, const float ty);
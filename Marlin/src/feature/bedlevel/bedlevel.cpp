@@ -143,7 +143,7 @@ void reset_bed_level() {
   /**
    * Print calibration results for plotting or manual frame adjustment.
    */
-  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, element_2d_fn fn) {
     #ifndef SCAD_MESH_OUTPUT
       for (uint8_t x = 0; x < sx; ++x) {
         SERIAL_ECHO_SP(precision + (x < 10 ? 3 : 2));
@@ -163,11 +163,7 @@ void reset_bed_level() {
       #endif
       for (uint8_t x = 0; x < sx; ++x) {
         SERIAL_CHAR(' ');
-        #if PROUI_EX
-          const float offset = proUIEx.getZvalues(sy, x, y, values);
-        #else
-          const float offset = values[x * sy + y];
-        #endif
+        const float offset = fn(x, y);
         if (!isnan(offset)) {
           if (offset >= 0) SERIAL_CHAR('+');
           SERIAL_ECHO(p_float_t(offset, precision));
@@ -198,6 +194,21 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
+  static const float *print_values;
+  static uint8_t print_sy;
+
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+    print_values = values;
+    print_sy = sy;
+    print_2d_array(sx, sy, precision, [](const uint8_t x, const uint8_t y) -> float {
+      #if PROUI_EX
+        return proUIEx.getZvalues(print_sy, x, y, print_values);
+      #else
+        return print_values[x * print_sy + y];
+      #endif
+    });
+  }
+
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
 #if ANY(MESH_BED_LEVELING, PROBE_MANUALLY)
@@ -36,6 +36,10 @@ unified_bed_leveling bedlevel;
 #include "../../../module/probe.h"
 #include "../../../module/temperature.h"
 
+#if ENABLED(OPTIMIZED_MESH_STORAGE) && !PROUI_EX
+  #include "../../../libs/crc16.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
 #endif
@@ -120,33 +124,123 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const float value) {
   constexpr float mesh_store_scaling = 1000;
   constexpr int16_t Z_STEPS_NAN = INT16_MAX;
 
-  void unified_bed_leveling::set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values) {
-    auto z_to_store = [](const float z) {
-      if (isnan(z)) return Z_STEPS_NAN;
-      const int32_t z_scaled = TRUNC(z * mesh_store_scaling);
-      if (z_scaled == Z_STEPS_NAN || !WITHIN(z_scaled, INT16_MIN, INT16_MAX))
-        return Z_STEPS_NAN; // If Z is out of range, return our custom 'NaN'
-      return int16_t(z_scaled);
-    };
-    #if PROUI_EX
-      for (uint8_t x = 0; x < GRID_LIMIT; ++x) for (uint8_t y = 0; y < GRID_LIMIT; ++y)
-    #else
-      GRID_LOOP(x, y)
-    #endif
-      stored_values[x][y] = z_to_store(in_values[x][y]);
+  static float store_to_z(const int16_t z_scaled) {
+    return z_scaled == Z_STEPS_NAN ? NAN : z_scaled / mesh_store_scaling;
   }
 
-  void unified_bed_leveling::set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values) {
-    auto store_to_z = [](const int16_t z_scaled) {
-      return z_scaled == Z_STEPS_NAN ? NAN : z_scaled / mesh_store_scaling;
-    };
-    #if PROUI_EX
+  #if PROUI_EX
+
+    void unified_bed_leveling::set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values) {
+      auto z_to_store = [](const float z) {
+        if (isnan(z)) return Z_STEPS_NAN;
+        const int32_t z_scaled = TRUNC(z * mesh_store_scaling);
+        if (z_scaled == Z_STEPS_NAN || !WITHIN(z_scaled, INT16_MIN, INT16_MAX))
+          return Z_STEPS_NAN; // If Z is out of range, return our custom 'NaN'
+        return int16_t(z_scaled);
+      };
       for (uint8_t x = 0; x < GRID_LIMIT; ++x) for (uint8_t y = 0; y < GRID_LIMIT; ++y)
-    #else
-      GRID_LOOP(x, y)
-    #endif
-      out_values[x][y] = store_to_z(stored_values[x][y]);
-  }
+        stored_values[x][y] = z_to_store(in_values[x][y]);
+    }
+
+    void unified_bed_leveling::set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values) {
+      for (uint8_t x = 0; x < GRID_LIMIT; ++x) for (uint8_t y = 0; y < GRID_LIMIT; ++y)
+        out_values[x][y] = store_to_z(stored_values[x][y]);
+    }
+
+  #else
+
+    static uint16_t mesh_store_crc(const mesh_store_t &stored_values) {
+      uint16_t crc = 0;
+      const uint8_t * const start = (const uint8_t*)&stored_values.z0;
+      crc16(&crc, start, sizeof(mesh_store_t) - (start - (const uint8_t*)&stored_values));
+      return crc;
+    }
+
+    /**
+     * Fit a plane to the valid mesh points by least squares, then store each
+     * point as its distance from the plane in units of the smallest quantum
+     * that keeps every residual within int8 range.
+     */
+    void unified_bed_leveling::set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values) {
+      // Normal equations for z = z0 + dzdx * x + dzdy * y, with x and y as mesh indexes
+      float n = 0, sx = 0, sy = 0, sz = 0, sxx = 0, sxy = 0, syy = 0, sxz = 0, syz = 0;
+      GRID_LOOP(x, y) {
+        const float z = in_values[x][y];
+        if (isnan(z)) continue;
+        n++; sx += x; sy += y; sz += z;
+        sxx += sq(x); sxy += x * y; syy += sq(y);
+        sxz += x * z; syz += y * z;
+      }
+
+      float z0 = 0, dzdx = 0, dzdy = 0;
+      const float det = n * (sxx * syy - sq(sxy)) - sx * (sx * syy - sxy * sy) + sy * (sx * sxy - sxx * sy);
+      if (ABS(det) > 1e-3f) {
+        z0   = (sz * (sxx * syy - sq(sxy)) - sx * (sxz * syy - sxy * syz) + sy * (sxz * sxy - sxx * syz)) / det;
+        dzdx = (n * (sxz * syy - syz * sxy) - sz * (sx * syy - sxy * sy) + sy * (sx * syz - sxz * sy)) / det;
+        dzdy = (n * (sxx * syz - sxy * sxz) - sx * (sx * syz - sxz * sy) + sz * (sx * sxy - sxx * sy)) / det;
+      }
+      else if (n) // Too few points for a plane. Use the mean height.
+        z0 = sz / n;
+
+      // Largest residual decides the quantum
+      float max_res = 0;
+      GRID_LOOP(x, y) {
+        const float z = in_values[x][y];
+        if (!isnan(z)) NOLESS(max_res, ABS(z - (z0 + dzdx * x + dzdy * y)));
+      }
+      const float quantum = constrain(CEIL(max_res * 1000.0f / 127.0f), 1, 255);
+
+      stored_values.magic = MESH_STORE_MAGIC;
+      stored_values.version = MESH_STORE_VERSION;
+      stored_values.quantum = uint8_t(quantum);
+      stored_values.z0 = z0;
+      stored_values.dzdx = dzdx;
+      stored_values.dzdy = dzdy;
+      GRID_LOOP(x, y) {
+        const float z = in_values[x][y];
+        const int16_t r = isnan(z) ? MESH_STORE_NAN : LROUND((z - (z0 + dzdx * x + dzdy * y)) * 1000.0f / quantum);
+        stored_values.residual[x][y] = WITHIN(r, -127, 127) ? int8_t(r) : MESH_STORE_NAN; // Out of range (> 32mm) becomes 'NaN'
+      }
+      stored_values.crc = mesh_store_crc(stored_values);
+    }
+
+    /**
+     * Rebuild the mesh from a compact slot.
+     * Return false, with an invalid mesh, if the slot is empty or corrupt.
+     */
+    bool unified_bed_leveling::set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values) {
+      const bool valid = stored_values.magic == MESH_STORE_MAGIC
+                      && stored_values.version == MESH_STORE_VERSION
+                      && stored_values.quantum
+                      && stored_values.crc == mesh_store_crc(stored_values);
+      const float quantum = stored_values.quantum / 1000.0f;
+      GRID_LOOP(x, y) {
+        const int8_t r = stored_values.residual[x][y];
+        out_values[x][y] = (!valid || r == MESH_STORE_NAN) ? NAN
+          : stored_values.z0 + stored_values.dzdx * x + stored_values.dzdy * y + r * quantum;
+      }
+      return valid;
+    }
+
+    /**
+     * Decode a slot written in the old int16 micron layout.
+     * Erased or blank storage decodes to a flat mesh, so require at least two
+     * distinct heights before trusting the data.
+     */
+    bool unified_bed_leveling::set_mesh_from_legacy_store(const mesh_store_legacy_t &stored_values, bed_mesh_t &out_values) {
+      int16_t first = Z_STEPS_NAN;
+      bool varied = false;
+      GRID_LOOP(x, y) {
+        const int16_t z_scaled = stored_values[x][y];
+        out_values[x][y] = store_to_z(z_scaled);
+        if (z_scaled == Z_STEPS_NAN) continue;
+        if (first == Z_STEPS_NAN) first = z_scaled;
+        else if (z_scaled != first) varied = true;
+      }
+      return varied;
+    }
+
+  #endif // !PROUI_EX
 
 #endif // OPTIMIZED_MESH_STORAGE
 
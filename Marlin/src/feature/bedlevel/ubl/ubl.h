@@ -43,11 +43,35 @@ struct mesh_index_pair;
   #define MESH_Y_DIST (float((MESH_MAX_Y) - (MESH_MIN_Y)) / (GRID_MAX_CELLS_Y))
 #endif
 
+#if !UBL_SEGMENTED && !defined(UBL_SEGMENT_TOLERANCE)
+  #define UBL_SEGMENT_TOLERANCE 0.002 // (mm) Max distance of a segment from the mesh surface
+#endif
+
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
   #if PROUI_EX
     typedef int16_t mesh_store_t[GRID_LIMIT][GRID_LIMIT];
   #else
-    typedef int16_t mesh_store_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    #define MESH_STORE_MAGIC    0xB5
+    #define MESH_STORE_VERSION  1
+    #define MESH_STORE_NAN      INT8_MIN
+
+    /**
+     * Compact mesh slot: a best-fit base plane plus one quantized residual per point.
+     * Residuals are stored in steps of 'quantum' microns, chosen per mesh as the
+     * smallest step that fits the largest residual, so a typical bed keeps a few
+     * microns of precision in roughly half the space of the old int16 store.
+     */
+    typedef struct {
+      uint8_t magic,      // MESH_STORE_MAGIC
+              version;    // MESH_STORE_VERSION
+      uint16_t crc;       // CRC16 of everything after this field
+      float z0, dzdx, dzdy; // Base plane z = z0 + dzdx * x + dzdy * y, in mesh indexes
+      uint8_t quantum;    // Residual step (µm)
+      int8_t residual[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    } mesh_store_t;
+
+    // Store layout used before MESH_STORE_VERSION 1, kept for migration
+    typedef int16_t mesh_store_legacy_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
   #endif
 #endif
 
@@ -119,8 +143,14 @@ public:
 
   static bed_mesh_t z_values;
   #if ENABLED(OPTIMIZED_MESH_STORAGE)
-    static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
-    static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+    #if PROUI_EX
+      static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
+      static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+    #else
+      static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
+      static bool set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+      static bool set_mesh_from_legacy_store(const mesh_store_legacy_t &stored_values, bed_mesh_t &out_values);
+    #endif
   #endif
   #if DISABLED(PROUI_EX)
     static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
@@ -310,6 +340,29 @@ public:
   #if UBL_SEGMENTED
     static bool line_to_destination_segmented(const feedRate_t scaled_fr_mm_s);
   #else
+    /**
+     * Bilinear patch of one mesh cell, fetched once while a move walks through it.
+     *   z = z0 + zx * dx + zy * dy + zxy * dx * dy
+     * where dx and dy are offsets from the cell's lower left mesh point.
+     */
+    typedef struct {
+      xy_pos_t origin;
+      float z0, zx, zy, zxy;
+      #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+        float raise;    // Off the mesh, a constant Z raise that isn't faded
+      #endif
+      float at(const xy_pos_t &pos) const {
+        const xy_pos_t d = pos - origin;
+        return z0 + zx * d.x + (zy + zxy * d.x) * d.y;
+      }
+    } cell_plane_t;
+
+    static void get_cell_plane(cell_plane_t &plane, const int8_t cx, const int8_t cy);
+
+    // Receives the leveled end point of each segment. Return false to abort the move.
+    typedef bool (*mesh_segment_fn)(const xyze_pos_t &target);
+    static bool walk_mesh_cells(const xyze_pos_t &start, const xyze_pos_t &end, const float fade_factor, mesh_segment_fn segment_fn);
+
     static void line_to_destination_cartesian(const feedRate_t scaled_fr_mm_s, const uint8_t e);
   #endif
 
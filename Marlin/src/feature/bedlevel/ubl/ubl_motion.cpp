@@ -40,292 +40,153 @@
 
 #if !UBL_SEGMENTED
 
-  // TODO: The first and last parts of a move might result in very short segment(s)
-  //       after getting split on the cell boundary, so moves like that should not
-  //       get split. This will be most common for moves that start/end near the
-  //       corners of cells. To fix the issue, simply check if the start/end of the line
-  //       is very close to a cell boundary in advance and don't split the line there.
+  #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+    // The regions beyond the mesh edges get their own (constant) cells
+    #define CELL_MIN_X -1
+    #define CELL_MIN_Y -1
+    #define CELL_MAX_X (GRID_MAX_CELLS_X)
+    #define CELL_MAX_Y (GRID_MAX_CELLS_Y)
+  #else
+    // Beyond the mesh edges Z correction is extrapolated from the edge cells
+    #define CELL_MIN_X 0
+    #define CELL_MIN_Y 0
+    #define CELL_MAX_X ((GRID_MAX_CELLS_X) - 1)
+    #define CELL_MAX_Y ((GRID_MAX_CELLS_Y) - 1)
+  #endif
 
-  void unified_bed_leveling::line_to_destination_cartesian(const feedRate_t scaled_fr_mm_s, const uint8_t extruder) {
-    /**
-     * Much of the nozzle movement will be within the same cell. So we will do as little computation
-     * as possible to determine if this is the case. If this move is within the same cell, we will
-     * just do the required Z-Height correction, call the Planner's buffer_line() routine, and leave
-     */
-    #if HAS_POSITION_MODIFIERS
-      xyze_pos_t start = current_position, end = destination;
-      planner.apply_modifiers(start);
-      planner.apply_modifiers(end);
-    #else
-      const xyze_pos_t &start = current_position, &end = destination;
+  void unified_bed_leveling::get_cell_plane(cell_plane_t &plane, const int8_t cx, const int8_t cy) {
+    #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+      // Off the mesh use a constant Z raise
+      if (!WITHIN(cx, 0, GRID_MAX_CELLS_X - 1) || !WITHIN(cy, 0, GRID_MAX_CELLS_Y - 1)) {
+        plane.origin.reset();
+        plane.z0 = plane.zx = plane.zy = plane.zxy = 0;
+        plane.raise = UBL_Z_RAISE_WHEN_OFF_MESH;
+        return;
+      }
+      plane.raise = 0;
     #endif
 
-    const xy_uint8_t istart = cell_indexes(start), iend = cell_indexes(end);
-
-    // A move within the same cell needs no splitting
-    if (istart == iend) {
-
-      FINAL_MOVE:
-
-      // When UBL_Z_RAISE_WHEN_OFF_MESH is disabled Z correction is extrapolated from the edge of the mesh
-      #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
-        // For a move off the UBL mesh, use a constant Z raise
-        if (!cell_index_x_valid(end.x) || !cell_index_y_valid(end.y)) {
+    plane.origin.set(get_mesh_x(cx), get_mesh_y(cy));
 
-          // Note: There is no Z Correction in this case. We are off the mesh and don't know what
-          // a reasonable correction would be, UBL_Z_RAISE_WHEN_OFF_MESH will be used instead of
-          // a calculated (Bi-Linear interpolation) correction.
+    const float z00 = z_values[cx][cy    ], z10 = z_values[cx + 1][cy    ],
+                z01 = z_values[cx][cy + 1], z11 = z_values[cx + 1][cy + 1];
 
-          end.z += UBL_Z_RAISE_WHEN_OFF_MESH;
-          planner.buffer_segment(end, scaled_fr_mm_s, extruder);
-          current_position = destination;
-          return;
-        }
-      #endif
-
-      // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
-      const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
-                  yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
-                  z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
-                  z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
-
-      // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
-      const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
-
-      // Undefined parts of the Mesh in z_values[][] are NAN.
-      // Replace NAN corrections with 0.0 to prevent NAN propagation.
-      if (!isnan(z0)) end.z += z0;
-      planner.buffer_segment(end, scaled_fr_mm_s, extruder);
-      current_position = destination;
+    // Undefined parts of the Mesh in z_values[][] are NAN.
+    // Like get_z_correction, apply no correction in such a cell.
+    if (isnan(z00 + z10 + z01 + z11)) {
+      plane.z0 = plane.zx = plane.zy = plane.zxy = 0;
       return;
     }
 
-    /**
-     * Past this point the move is known to cross one or more mesh lines. Check for the most common
-     * case - crossing only one X or Y line - after details are worked out to reduce computation.
-     */
-
-    const xy_float_t dist = end - start;
-    const xy_bool_t neg { dist.x < 0, dist.y < 0 };
-    const xy_uint8_t ineg { uint8_t(neg.x), uint8_t(neg.y) };
-    const xy_float_t sign { neg.x ? -1.0f : 1.0f, neg.y ? -1.0f : 1.0f };
-    const xy_int8_t iadd { int8_t(iend.x == istart.x ? 0 : sign.x), int8_t(iend.y == istart.y ? 0 : sign.y) };
-
-    /**
-     * Compute the extruder scaling factor for each partial move, checking for
-     * zero-length moves that would result in an infinite scaling factor.
-     * A float divide is required for this, but then it just multiplies.
-     * Also select a scaling factor based on the larger of the X and Y
-     * components. The larger of the two is used to preserve precision.
-     */
-
-    const xy_float_t ad = sign * dist;
-    const bool use_x_dist = ad.x > ad.y;
-
-    float on_axis_distance = use_x_dist ? dist.x : dist.y;
-
-    const float z_normalized_dist = (end.z - start.z) / on_axis_distance; // Allow divide by zero
-    #if HAS_EXTRUDERS
-      const float e_normalized_dist = (end.e - start.e) / on_axis_distance;
-      const bool inf_normalized_flag = isinf(e_normalized_dist);
-    #endif
-
-    xy_uint8_t icell = istart;
-
-    const float ratio = dist.y / dist.x,        // Allow divide by zero
-                c = start.y - ratio * start.x;
-
-    const bool inf_ratio_flag = isinf(ratio);
-
-    xyze_pos_t dest; // Stores XYZE for segmented moves
-
-    /**
-     * Handle vertical lines that stay within one column.
-     * These need not be perfectly vertical.
-     */
-    if (iadd.x == 0) {        // Vertical line?
-      icell.y += ineg.y;      // Line going down? Just go to the bottom.
-      while (icell.y != iend.y + ineg.y) {
-        icell.y += iadd.y;
-        const float next_mesh_line_y = get_mesh_y(icell.y);
-
-        /**
-         * Skip the calculations for an infinite slope.
-         * For others the next X is the same so this can continue.
-         * Calculate X at the next Y mesh line.
-         */
-        dest.x = inf_ratio_flag ? start.x : (next_mesh_line_y - c) / ratio;
-
-        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x, icell.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        dest.y = get_mesh_y(icell.y);
-
-        /**
-         * Without this check, it's possible to generate a zero length move, as in the case where
-         * the line is heading down, starting exactly on a mesh line boundary. Since this is rare
-         * it might be fine to remove this check and let planner.buffer_segment() filter it out.
-         */
-        if (dest.y != start.y) {
-          if (!inf_normalized_flag) { // fall-through faster than branch
-            on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-            TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist);
-            dest.z = start.z + on_axis_distance * z_normalized_dist;
-          }
-          else {
-            TERN_(HAS_EXTRUDERS, dest.e = end.e);
-            dest.z = end.z;
-          }
-
-          dest.z += z0;
-          planner.buffer_segment(dest, scaled_fr_mm_s, extruder);
-
-        }
-        else
-          DEBUG_ECHOLNPGM("[ubl] skip Y segment");
-      }
+    const float inv_dx = 1.0f / (get_mesh_x(cx + 1) - plane.origin.x),
+                inv_dy = 1.0f / (get_mesh_y(cy + 1) - plane.origin.y);
 
-      // At the final destination? Usually not, but when on a Y Mesh Line it's completed.
-      if (xy_pos_t(current_position) != xy_pos_t(end))
-        goto FINAL_MOVE;
-
-      current_position = destination;
-      return;
-    }
+    plane.z0 = z00;
+    plane.zx = (z10 - z00) * inv_dx;
+    plane.zy = (z01 - z00) * inv_dy;
+    plane.zxy = (z11 - z10 - z01 + z00) * inv_dx * inv_dy;
+  }
 
-    /**
-     * Handle horizontal lines that stay within one row.
-     * These need not be perfectly horizontal.
-     */
-    if (iadd.y == 0) {      // Horizontal line?
-      icell.x += ineg.x;     // Heading left? Just go to the left edge of the cell for the first move.
-
-      while (icell.x != iend.x + ineg.x) {
-        icell.x += iadd.x;
-        dest.x = get_mesh_x(icell.x);
-        dest.y = ratio * dest.x + c;    // Calculate Y at the next X mesh line
-
-        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x, icell.y)
-                     * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        /**
-         * Without this check, it's possible to generate a zero length move, as in the case where
-         * the line is heading left, starting exactly on a mesh line boundary. Since this is rare
-         * it might be fine to remove this check and let planner.buffer_segment() filter it out.
-         */
-        if (dest.x != start.x) {
-          if (!inf_normalized_flag) {
-            on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-            TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist); // Based on X or Y because the move is horizontal
-            dest.z = start.z + on_axis_distance * z_normalized_dist;
-          }
-          else {
-            TERN_(HAS_EXTRUDERS, dest.e = end.e);
-            dest.z = end.z;
-          }
-
-          dest.z += z0;
-          if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
+  // TODO: The first and last parts of a move might result in very short segment(s)
+  //       after getting split on the cell boundary, so moves like that should not
+  //       get split. This will be most common for moves that start/end near the
+  //       corners of cells. To fix the issue, simply check if the start/end of the line
+  //       is very close to a cell boundary in advance and don't split the line there.
 
+  /**
+   * Walk a Cartesian move through each mesh cell it crosses and pass the leveled
+   * end point of every segment to segment_fn. The bilinear patch of each cell is
+   * computed once on entry.
+   *
+   * Along a straight line the patch is a parabola in Z. Only the twist term (zxy)
+   * bends it, so planar cells and axis-aligned moves get exactly one segment per
+   * cell. Otherwise the piece is split just enough to keep every chord within
+   * UBL_SEGMENT_TOLERANCE of the mesh surface.
+   *
+   * Returns false if segment_fn aborted the move.
+   */
+  bool unified_bed_leveling::walk_mesh_cells(const xyze_pos_t &start, const xyze_pos_t &end, const float fade_factor, mesh_segment_fn segment_fn) {
+    const xyze_float_t total = end - start;
+    const xy_int8_t dir = { int8_t(SIGN(total.x)), int8_t(SIGN(total.y)) };
+
+    xy_int8_t icell = { cell_index_x_raw(start.x), cell_index_y_raw(start.y) };
+    LIMIT(icell.x, CELL_MIN_X, CELL_MAX_X);
+    LIMIT(icell.y, CELL_MIN_Y, CELL_MAX_Y);
+
+    // A move heading down/left from a mesh line starts in the cell below/left of it
+    if (dir.x < 0 && icell.x > CELL_MIN_X && start.x <= get_mesh_x(icell.x)) icell.x--;
+    if (dir.y < 0 && icell.y > CELL_MIN_Y && start.y <= get_mesh_y(icell.y)) icell.y--;
+
+    // The t² coefficient of Z along the move, per unit of zxy
+    const float twist_scale = ABS(total.x * total.y) * fade_factor;
+
+    cell_plane_t plane;
+    float t0 = 0.0f;
+    for (;;) {
+      // Fraction of the move at which the next X and Y mesh lines are crossed
+      float tx = 1.0f, ty = 1.0f;
+      if (dir.x > 0 && icell.x < CELL_MAX_X) tx = (get_mesh_x(icell.x + 1) - start.x) / total.x;
+      if (dir.x < 0 && icell.x > CELL_MIN_X) tx = (get_mesh_x(icell.x) - start.x) / total.x;
+      if (dir.y > 0 && icell.y < CELL_MAX_Y) ty = (get_mesh_y(icell.y + 1) - start.y) / total.y;
+      if (dir.y < 0 && icell.y > CELL_MIN_Y) ty = (get_mesh_y(icell.y) - start.y) / total.y;
+
+      const float t1 = _MIN(tx, ty, 1.0f);
+
+      if (t1 > t0) {
+        get_cell_plane(plane, icell.x, icell.y);
+
+        // The midpoint of a chord spanning dt deviates from the parabola by a * dt² / 4
+        const float a = ABS(plane.zxy) * twist_scale, span = t1 - t0;
+        uint16_t pieces = 1;
+        if (a > 0) NOLESS(pieces, uint16_t(CEIL(span * SQRT(a * (0.25f / (UBL_SEGMENT_TOLERANCE))))));
+        const float dt = span / pieces;
+
+        for (uint16_t i = 1; i <= pieces; ++i) {
+          const bool last_piece = (i == pieces);
+          xyze_pos_t dest;
+          if (last_piece && t1 >= 1.0f)
+            dest = end;                                   // Use the destination for an exact end
+          else
+            dest = start + total * (last_piece ? t1 : t0 + dt * i);
+
+          dest.z += plane.at(dest) * fade_factor;
+          #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+            dest.z += plane.raise;
+          #endif
+          if (!segment_fn(dest)) return false;
         }
-        else
-          DEBUG_ECHOLNPGM("[ubl] skip Y segment");
+        t0 = t1;
       }
 
-      if (xy_pos_t(current_position) != xy_pos_t(end))
-        goto FINAL_MOVE;
+      if (t1 >= 1.0f) break;
 
-      current_position = destination;
-      return;
+      // Step into the next cell, diagonally if the move passes through a mesh point
+      if (tx <= t1) icell.x += dir.x;
+      if (ty <= t1) icell.y += dir.y;
     }
 
-    /**
-     * Generic case of a line crossing both X and Y Mesh lines.
-     */
-
-    xy_uint8_t cnt = istart.diff(iend);
-
-    icell += ineg;
-
-    while (cnt) {
-
-      const float next_mesh_line_x = get_mesh_x(icell.x + iadd.x),
-                  next_mesh_line_y = get_mesh_y(icell.y + iadd.y);
-
-      dest.y = ratio * next_mesh_line_x + c;    // Calculate Y at the next X mesh line
-      dest.x = (next_mesh_line_y - c) / ratio;  // Calculate X at the next Y mesh line
-                                                // (No need to worry about ratio == 0.
-                                                //  In that case, it was already detected
-                                                //  as a vertical line move above.)
-
-      if (neg.x == (dest.x > next_mesh_line_x)) { // Check if we hit the Y line first
-        // Yes!  Crossing a Y Mesh Line next
-        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x - ineg.x, icell.y + iadd.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        dest.y = next_mesh_line_y;
-
-        if (!inf_normalized_flag) {
-          on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-          TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist);
-          dest.z = start.z + on_axis_distance * z_normalized_dist;
-        }
-        else {
-          TERN_(HAS_EXTRUDERS, dest.e = end.e);
-          dest.z = end.z;
-        }
-
-        dest.z += z0;
-        if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
-
-        icell.y += iadd.y;
-        cnt.y--;
-      }
-      else {
-        // Yes!  Crossing a X Mesh Line next
-        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x + iadd.x, icell.y - ineg.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        dest.x = next_mesh_line_x;
-
-        if (!inf_normalized_flag) {
-          on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-          TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist);
-          dest.z = start.z + on_axis_distance * z_normalized_dist;
-        }
-        else {
-          TERN_(HAS_EXTRUDERS, dest.e = end.e);
-          dest.z = end.z;
-        }
+    return true;
+  }
 
-        dest.z += z0;
-        if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
+  static feedRate_t segment_fr_mm_s;
+  static uint8_t segment_extruder;
 
-        icell.x += iadd.x;
-        cnt.x--;
-      }
+  static bool buffer_mesh_segment(const xyze_pos_t &target) {
+    return planner.buffer_segment(target, segment_fr_mm_s, segment_extruder);
+  }
 
-      if (cnt.x < 0 || cnt.y < 0) break; // Too far! Exit the loop and go to FINAL_MOVE
-    }
+  void unified_bed_leveling::line_to_destination_cartesian(const feedRate_t scaled_fr_mm_s, const uint8_t extruder) {
+    #if HAS_POSITION_MODIFIERS
+      xyze_pos_t start = current_position, end = destination;
+      planner.apply_modifiers(start);
+      planner.apply_modifiers(end);
+    #else
+      const xyze_pos_t &start = current_position, &end = destination;
+    #endif
 
-    if (xy_pos_t(current_position) != xy_pos_t(end))
-      goto FINAL_MOVE;
+    segment_fr_mm_s = scaled_fr_mm_s;
+    segment_extruder = extruder;
+    walk_mesh_cells(start, end, planner.fade_scaling_factor_for_z(end.z), buffer_mesh_segment);
 
     current_position = destination;
   }
@@ -76,4 +76,83 @@ void CancelObject::report() {
   SERIAL_EOL();
 }
 
+#if HAS_MEDIA
+
+  cancel_ingest_t CancelObject::ingest;
+
+  void CancelObject::reset_ingest() {
+    ingest = cancel_ingest_t();
+    TERN_(HAS_EXTRUDERS, ingest.e_relative = gcode.axis_is_relative(E_AXIS));
+  }
+
+  // Copy the value of a G-code word, if present
+  static void copy_word(char * const dst, const uint8_t size, const char *src) {
+    if (!src) return;
+    uint8_t i = 0;
+    for (++src; i < size - 1 && (NUMERIC(*src) || *src == '-' || *src == '.'); ++src) dst[i++] = *src;
+    dst[i] = '\0';
+  }
+
+  /**
+   * Check a line read from the SD card before it is queued.
+   * M486 markers are tracked here as well as in M486, since the reader runs ahead.
+   * Moves (G0-G3, G5) of a canceled object are dropped, but their E and F are
+   * kept so the moves that follow see the same modal state. In relative mode
+   * the E of all dropped moves is added up, as running them would have done.
+   * Return true to drop the line.
+   */
+  bool CancelObject::ingest_line(const char *cmd) {
+    while (*cmd == ' ') cmd++;
+
+    if (cmd[0] == 'M' && cmd[1] == '4' && cmd[2] == '8' && cmd[3] == '6' && !NUMERIC(cmd[4])) {
+      // Check the letter of each parameter. A (object name) takes the rest of the line.
+      for (const char *p = cmd + 4; *p && *p != 'A';) {
+        switch (*p) {
+          case 'T': case 'U': ingest.object = -1; ingest.hold = true; break;
+          case 'S': ingest.object = atoi(p + 1); break;
+          default: break;
+        }
+        while (*p && *p != ' ') p++;
+        while (*p == ' ') p++;
+      }
+      return false;
+    }
+
+    // M82/M83 and G90/G91 set the E mode of the moves that follow
+    if (((cmd[0] == 'M' && cmd[1] == '8' && WITHIN(cmd[2], '2', '3')) || (cmd[0] == 'G' && cmd[1] == '9' && WITHIN(cmd[2], '0', '1'))) && !NUMERIC(cmd[3]) && cmd[3] != '.') {
+      ingest.e_relative = (cmd[2] == '3' || cmd[2] == '1');
+      return false;
+    }
+
+    if (cmd[0] != 'G' || ingest.hold || !WITHIN(ingest.object, 0, 31) || !is_canceled(ingest.object)) return false;
+
+    const char *g = cmd + 1;
+    while (*g == '0' && NUMERIC(g[1])) g++;
+    if (!(WITHIN(*g, '0', '3') || *g == '5') || NUMERIC(g[1]) || g[1] == '.') return false;
+
+    const char * const e = strchr(g, 'E');
+    if (!ingest.e_relative)
+      copy_word(ingest.e, sizeof(ingest.e), e);
+    else if (e)
+      ingest.e_sum += atof(e + 1);
+    copy_word(ingest.f, sizeof(ingest.f), strchr(g, 'F'));
+    return true;
+  }
+
+  /**
+   * Write a single move that sets the E position and feedrate left by the dropped moves.
+   * The move runs while the object is still skipped, so it doesn't move or extrude.
+   */
+  void CancelObject::ingest_flush(char * const buf) {
+    MString<MAX_CMD_SIZE - 1> cmd(F("G1"));
+    if (ingest.f[0]) cmd.append(F(" F"), ingest.f);
+    if (ingest.e[0]) cmd.append(F(" E"), ingest.e);
+    if (ingest.e_sum) cmd.append(F(" E"), p_float_t(ingest.e_sum, 5));
+    strcpy(buf, &cmd);
+    ingest.e[0] = ingest.f[0] = '\0';
+    ingest.e_sum = 0;
+  }
+
+#endif // HAS_MEDIA
+
 #endif // CANCEL_OBJECTS
@@ -29,9 +29,27 @@ typedef struct CancelState {
   uint32_t canceled = 0x0000;
 } cancel_state_t;
 
+#if HAS_MEDIA
+  // State of the SD reader, which runs ahead of the command queue
+  typedef struct CancelIngest {
+    int8_t object = -1;       // Object of the last M486 S read from the file
+    bool hold = false;        // M486 T or U was read but not run yet. Don't drop lines until the queue drains.
+    bool e_relative = false;  // E mode (M82/M83, G90/G91) of the lines read so far
+    float e_sum = 0;          // Total E of the dropped moves in relative mode
+    char e[16] = "", f[12] = "";  // Last E (absolute mode) and F of the dropped moves, still to be queued
+  } cancel_ingest_t;
+#endif
+
 class CancelObject {
 public:
   static cancel_state_t state;
+  #if HAS_MEDIA
+    static cancel_ingest_t ingest;
+    static bool ingest_line(const char *cmd);
+    static bool ingest_pending() { return ingest.e[0] || ingest.f[0] || ingest.e_sum; }
+    static void ingest_flush(char * const buf);
+    static void reset_ingest();
+  #endif
   static void set_active_object(const int8_t obj=state.active_object);
   static void cancel_object(const int8_t obj);
   static void uncancel_object(const int8_t obj);
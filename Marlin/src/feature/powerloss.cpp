@@ -45,6 +45,7 @@ bool PrintJobRecovery::enabled; // Initialized by settings.load
 MediaFile PrintJobRecovery::file;
 job_recovery_info_t PrintJobRecovery::info;
 const char PrintJobRecovery::filename[5] = "/PLR";
+uint32_t PrintJobRecovery::journal_seq; // = 0
 uint8_t PrintJobRecovery::queue_index_r;
 uint32_t PrintJobRecovery::cmd_sdpos, // = 0
          PrintJobRecovery::sdpos[BUFSIZE];
@@ -61,6 +62,7 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
 #include "../module/planner.h"
 #include "../module/printcounter.h"
 #include "../module/temperature.h"
+#include "../libs/crc16.h"
 
 #if ENABLED(CV_LASER_MODULE)
   #include "../prouiex/cv_laser_module.h"
@@ -108,7 +110,7 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { info = { 0 }; }
+void PrintJobRecovery::init() { info = { 0 }; journal_seq = 0; }
 
 /**
  * Enable or disable then call changed()
@@ -172,16 +174,50 @@ void PrintJobRecovery::cancel() {
  */
 void PrintJobRecovery::purge() {
   init();
+  TERN_(PLR_BACKUP_SRAM, backup_clear());
   card.removeJobRecoveryFile();
 }
 
 /**
- * Load the recovery data, if it exists
+ * Load the recovery data, if it exists.
+ * Use the newest journal record that passes its CRC, so a save cut short
+ * by the outage falls back to the one before it.
  */
 void PrintJobRecovery::load() {
-  if (exists()) {
+  journal_seq = 0;
+
+  // The backup SRAM is never older than the file
+  if (TERN0(PLR_BACKUP_SRAM, backup_load(true))) {
+    debug(F("Load (SRAM)"));
+    return;
+  }
+
+  if (card.jobRecoverFileExists()) {
     open(true);
-    (void)file.read(&info, sizeof(info));
+    if (file.fileSize() == PLR_JOURNAL_SIZE) {
+      uint32_t seqs[PLR_JOURNAL_SLOTS];
+      for (uint8_t s = 0; s < PLR_JOURNAL_SLOTS; ++s) {
+        plr_record_head_t head;
+        seqs[s] = (file.seekSet(s * PLR_SLOT_SIZE) && file.read(&head, sizeof(head)) == sizeof(head) && head.size == sizeof(info)) ? head.seq : 0;
+      }
+      for (;;) {
+        uint8_t best = 0;
+        for (uint8_t s = 1; s < PLR_JOURNAL_SLOTS; ++s) if (seqs[s] > seqs[best]) best = s;
+        if (!seqs[best]) { init(); break; }   // No valid record
+        plr_record_head_t head;
+        file.seekSet(best * PLR_SLOT_SIZE);
+        if (file.read(&head, sizeof(head)) == sizeof(head) && file.read(&info, sizeof(info)) == sizeof(info)) {
+          uint16_t crc = 0;
+          crc16(&crc, &info, sizeof(info));
+          if (crc == head.crc) { journal_seq = head.seq; break; }
+        }
+        seqs[best] = 0;                       // Torn or corrupt. Try the next newest.
+      }
+    }
+    else if (file.fileSize() == sizeof(info))
+      (void)file.read(&info, sizeof(info));   // File saved before the journal format
+    else
+      init();
     close();
   }
   debug(F("Load"));
@@ -292,10 +328,129 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
-    write();
+    #if ENABLED(PLR_BACKUP_SRAM)
+      backup_save(true);
+      if (force) write();         // Pause, outage, and M413 W also go to the SD card
+    #else
+      write();
+    #endif
   }
+  #if ENABLED(PLR_BACKUP_SRAM)
+    else
+      backup_save(false);         // Keep the position and file offset current
+  #endif
 }
 
+#if ENABLED(PLR_BACKUP_SRAM)
+
+  #define BACKUP_IMAGE ((volatile plr_backup_t*)(hal.backup_sram() + hal.backup_sram_size - sizeof(plr_backup_t)))
+  static_assert(sizeof(plr_backup_t) <= MarlinHAL::backup_sram_size, "job_recovery_info_t is too large for the backup SRAM.");
+
+  static uint32_t backup_seq,       // Sequence number of the last record written
+                  backup_full_seq;  // Sequence number of the last full record
+
+  static void backup_write(volatile void * const dst, const void * const src, const size_t size) {
+    volatile uint8_t *d = (volatile uint8_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+    for (size_t i = 0; i < size; ++i) d[i] = s[i];
+  }
+
+  static void backup_read(void * const dst, const volatile void * const src, const size_t size) {
+    uint8_t *d = (uint8_t*)dst;
+    const volatile uint8_t *s = (const volatile uint8_t*)src;
+    for (size_t i = 0; i < size; ++i) d[i] = s[i];
+  }
+
+  // Read a record from a slot into the buffer. Return its sequence number, or 0 if invalid.
+  static uint32_t backup_read_slot(void * const buf, const volatile plr_record_head_t * const vhead, const size_t size) {
+    plr_record_head_t head;
+    backup_read(&head, vhead, sizeof(head));
+    if (!head.seq || head.size != size) return 0;
+    backup_read(buf, vhead + 1, size);
+    uint16_t crc = 0;
+    crc16(&crc, buf, size);
+    return crc == head.crc ? head.seq : 0;
+  }
+
+  static void backup_write_slot(volatile plr_record_head_t * const vhead, const uint32_t seq, const void * const buf, const size_t size) {
+    plr_record_head_t head = { 0 };
+    backup_write(vhead, &head, sizeof(head));   // Invalidate the slot first
+    backup_write(vhead + 1, buf, size);
+    head.seq = seq;
+    head.size = size;
+    crc16(&head.crc, buf, size);
+    backup_write(vhead, &head, sizeof(head));
+  }
+
+  /**
+   * Save to backup SRAM. A full save copies the whole record.
+   * Otherwise only the fields that change from move to move.
+   */
+  void PrintJobRecovery::backup_save(const bool full) {
+    volatile plr_backup_t * const bkp = BACKUP_IMAGE;
+    if (!++backup_seq) ++backup_seq;            // non-zero in sequence
+    if (full) {
+      backup_full_seq = backup_seq;
+      backup_write_slot(&bkp->full[backup_seq & 1].head, backup_seq, &info, sizeof(info));
+    }
+    else if (backup_full_seq) {
+      plr_hot_state_t hot;
+      hot.full_seq = backup_full_seq;
+      hot.sdpos = info.sdpos;
+      hot.current_position = info.current_position;
+      hot.feedrate = uint16_t(MMS_TO_MMM(feedrate_mm_s));
+      hot.print_job_elapsed = print_job_timer.duration();
+      backup_write_slot(&bkp->hot[backup_seq & 1].head, backup_seq, &hot, sizeof(hot));
+    }
+  }
+
+  /**
+   * Find the newest valid full record in backup SRAM and, if 'apply' is set,
+   * load it into 'info' with the newest hot fields saved after it.
+   */
+  bool PrintJobRecovery::backup_load(const bool apply) {
+    volatile plr_backup_t * const bkp = BACKUP_IMAGE;
+    job_recovery_info_t full[2];
+    const uint32_t s0 = backup_read_slot(&full[0], &bkp->full[0].head, sizeof(info)),
+                   s1 = backup_read_slot(&full[1], &bkp->full[1].head, sizeof(info));
+    if (!s0 && !s1) return false;
+    const uint8_t f = s1 > s0;
+    if (!full[f].valid()) return false;
+    if (!apply) return true;
+
+    info = full[f];
+    const uint32_t fseq = f ? s1 : s0;
+    backup_seq = backup_full_seq = fseq;
+
+    plr_hot_state_t hot[2];
+    uint32_t h[2];
+    for (uint8_t i = 0; i < 2; ++i) {
+      h[i] = backup_read_slot(&hot[i], &bkp->hot[i].head, sizeof(plr_hot_state_t));
+      if (h[i] && hot[i].full_seq != fseq) h[i] = 0;  // Belongs to an older full record
+    }
+    if (h[0] || h[1]) {
+      const plr_hot_state_t &n = hot[h[1] > h[0]];
+      info.sdpos = n.sdpos;
+      info.current_position = n.current_position;
+      info.feedrate = n.feedrate;
+      info.print_job_elapsed = n.print_job_elapsed;
+      backup_seq = _MAX(h[0], h[1]);
+    }
+    return true;
+  }
+
+  void PrintJobRecovery::backup_clear() {
+    volatile plr_backup_t * const bkp = BACKUP_IMAGE;
+    const plr_record_head_t head = { 0 };
+    backup_full_seq = 0;
+    for (uint8_t i = 0; i < 2; ++i) {
+      backup_write(&bkp->full[i].head, &head, sizeof(head));
+      backup_write(&bkp->hot[i].head, &head, sizeof(head));
+    }
+  }
+
+#endif // PLR_BACKUP_SRAM
+
 #if PIN_EXISTS(POWER_LOSS)
 
   #if ENABLED(BACKUP_POWER_SUPPLY)
@@ -389,10 +544,32 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+  // Use the existing journal, if it was loaded or started by this session
+  if (journal_seq && card.jobRecoverFileExists()) {
+    open(false);
+    if (file.isOpen() && file.fileSize() != PLR_JOURNAL_SIZE) close();
+  }
+
+  // Otherwise preallocate a new one and empty its slots
+  if (!file.isOpen()) {
+    if (!card.createJobRecoveryFile(PLR_JOURNAL_SIZE)) return;
+    const plr_record_head_t empty = { 0 };
+    for (uint8_t s = 0; s < PLR_JOURNAL_SLOTS; ++s)
+      if (!file.seekSet(s * PLR_SLOT_SIZE) || file.write(&empty, sizeof(empty)) == -1) break;
+    journal_seq = 0;
+  }
+
+  // Append the record to the next slot
+  plr_record_head_t head;
+  if (!++journal_seq) ++journal_seq; // non-zero in sequence
+  head.seq = journal_seq;
+  head.size = sizeof(info);
+  head.crc = 0;
+  crc16(&head.crc, &info, sizeof(info));
+
+  file.seekSet((journal_seq % PLR_JOURNAL_SLOTS) * PLR_SLOT_SIZE);
+  if (file.write(&head, sizeof(head)) == -1 || file.write(&info, sizeof(info)) == -1)
+    DEBUG_ECHOLNPGM("Power-loss file write failed.");
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
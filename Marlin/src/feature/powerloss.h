@@ -57,6 +57,10 @@
 //#define SAVE_EACH_CMD_MODE
 //#define SAVE_INFO_INTERVAL_MS 0
 
+#ifndef PLR_JOURNAL_SLOTS
+  #define PLR_JOURNAL_SLOTS 16
+#endif
+
 typedef struct {
   uint8_t valid_head;
 
@@ -151,6 +155,44 @@ typedef struct {
 
 } job_recovery_info_t;
 
+/**
+ * The recovery file is a journal of PLR_JOURNAL_SLOTS fixed slots, each
+ * starting on a sector boundary. Every save goes to the next slot in turn,
+ * so a save rewrites one sector in place and never changes the file size
+ * or the FAT. The valid record with the highest sequence number is current.
+ */
+typedef struct {
+  uint32_t seq;   // Save counter, 0 for an empty slot
+  uint16_t size,  // sizeof(job_recovery_info_t), to reject records from other builds
+           crc;   // CRC16 of the job_recovery_info_t that follows
+} plr_record_head_t;
+
+#define PLR_SLOT_SIZE (CEILING(sizeof(plr_record_head_t) + sizeof(job_recovery_info_t), 512) * 512)
+#define PLR_JOURNAL_SIZE (uint32_t(PLR_JOURNAL_SLOTS) * PLR_SLOT_SIZE)
+
+#if ENABLED(PLR_BACKUP_SRAM)
+
+  // The fields the Stepper ISR and G-code parser keep changing between full saves
+  typedef struct {
+    uint32_t full_seq;  // Sequence number of the full record these fields update
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    uint16_t feedrate;
+    millis_t print_job_elapsed;
+  } plr_hot_state_t;
+
+  /**
+   * Backup SRAM image, kept at the end of the backup SRAM.
+   * Full and hot records are each written alternately to two slots,
+   * so a write cut short by a reset leaves the previous one intact.
+   */
+  typedef struct {
+    struct { plr_record_head_t head; job_recovery_info_t info; } full[2];
+    struct { plr_record_head_t head; plr_hot_state_t state; } hot[2];
+  } plr_backup_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -158,6 +200,8 @@ class PrintJobRecovery {
     static MediaFile file;
     static job_recovery_info_t info;
 
+    static uint32_t journal_seq;      //!< Sequence number of the last saved record
+
     static uint8_t queue_index_r;     //!< Queue index of the active command
     static uint32_t cmd_sdpos,        //!< SD position of the next command
                     sdpos[BUFSIZE];   //!< SD positions of queued commands
@@ -196,7 +240,7 @@ class PrintJobRecovery {
       static celsius_t bed_temp_threshold;
     #endif
 
-    static bool exists() { return card.jobRecoverFileExists(); }
+    static bool exists() { return TERN0(PLR_BACKUP_SRAM, backup_load(false)) || card.jobRecoverFileExists(); }
     static void open(const bool read) { card.openJobRecoveryFile(read); }
     static void close() { file.close(); }
 
@@ -241,6 +285,12 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(PLR_BACKUP_SRAM)
+      static void backup_save(const bool full);
+      static bool backup_load(const bool apply);
+      static void backup_clear();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const float zraise);
     #endif
@@ -0,0 +1,342 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/time_estimate.cpp - Print time estimate from a simulation of the media file
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_TIME_ESTIMATE)
+
+#include "time_estimate.h"
+#include "../sd/cardreader.h"
+#include "../module/planner.h"
+#include "../module/motion.h"
+
+TimeEstimate timeEstimate;
+
+bool TimeEstimate::done;
+float TimeEstimate::table[SD_TIME_ESTIMATE_POINTS + 1], TimeEstimate::step, TimeEstimate::elapsed;
+uint8_t TimeEstimate::next_point;
+sim_block_t TimeEstimate::blocks[SD_TIME_ESTIMATE_BLOCKS];
+uint8_t TimeEstimate::block_count;
+xyze_pos_t TimeEstimate::position;
+xyze_float_t TimeEstimate::prev_unit;
+float TimeEstimate::feedrate, TimeEstimate::prev_nominal_speed,
+      TimeEstimate::print_accel, TimeEstimate::travel_accel, TimeEstimate::retract_accel;
+bool TimeEstimate::relative_xyz, TimeEstimate::relative_e;
+
+// Reader of the printing file, independent of the print
+static MediaFile file;
+static bool started;                  // The simulation belongs to the open file
+static char cmd[MAX_CMD_SIZE];        // Line being read
+static uint8_t cmd_len;
+static char buffer[512];              // Whole blocks are read directly, leaving the volume cache to the print
+
+void TimeEstimate::reset() {
+  file.close();
+  started = done = false;
+}
+
+void TimeEstimate::begin(const uint32_t size) {
+  done = false;
+  step = float(size) / (SD_TIME_ESTIMATE_POINTS);
+  elapsed = 0;
+  table[0] = 0;
+  next_point = 1;
+  block_count = 0;
+  position.reset();
+  prev_unit.reset();
+  feedrate = MMM_TO_MMS(DEFAULT_FEEDRATE_MM_M);
+  prev_nominal_speed = 0;
+  print_accel = planner.settings.acceleration;
+  travel_accel = planner.settings.travel_acceleration;
+  retract_accel = planner.settings.retract_acceleration;
+  relative_xyz = relative_e = false;
+  cmd_len = 0;
+}
+
+void TimeEstimate::idle() {
+  // Forget the simulation when the print file closes
+  if (!card.isFileOpen()) {
+    if (started) reset();
+    return;
+  }
+
+  if (!started) {
+    if (!card.isPrinting()) return;
+    started = true;
+    file = card.getFile();
+    if (!file.seekSet(0)) { file.close(); return; }
+    begin(file.fileSize());
+  }
+
+  if (done || !file.isOpen()) return;
+
+  // Read only while the Planner has moves to spare, so the print never waits for the simulation
+  if (planner.movesplanned() <= (BLOCK_BUFFER_SIZE) / 2) return;
+
+  const uint32_t pos = file.curPosition();
+  const int16_t n = file.read(buffer, sizeof(buffer));
+  if (n < 0) { file.close(); return; }  // Read error. Leave the estimate to the print timer.
+
+  for (int16_t i = 0; i < n; ++i) {
+    const char c = buffer[i];
+    if (ISEOL(c)) {
+      if (cmd_len) {
+        cmd[cmd_len] = '\0';
+        line(cmd, pos + i + 1);
+        cmd_len = 0;
+      }
+    }
+    else if (cmd_len < sizeof(cmd) - 1)
+      cmd[cmd_len++] = c;
+  }
+
+  if (n < int16_t(sizeof(buffer))) {  // End of the file
+    if (cmd_len) {
+      cmd[cmd_len] = '\0';
+      line(cmd, pos + n);
+    }
+    file.close();
+    finish();
+  }
+}
+
+// Get a parameter of the command, if it's there
+static bool param(const char * const gcode, const char code, float &value) {
+  for (const char *p = gcode + 1; *p; ++p)
+    if (*p == code) { value = strtof(p + 1, nullptr); return true; }
+  return false;
+}
+
+void TimeEstimate::line(char * const gcode, const uint32_t endpos) {
+  char * const comment = strchr(gcode, ';');
+  if (comment) *comment = '\0';
+
+  const char *p = gcode;
+  while (*p == ' ') ++p;
+  if (*p == 'N') {                    // Skip the line number
+    while (*p && *p != ' ') ++p;
+    while (*p == ' ') ++p;
+  }
+
+  const char letter = *p;
+  const int code = atoi(p + 1);
+  float v;
+
+  if (letter == 'G') switch (code) {
+    case 0: case 1: case 2: case 3: {
+      if (param(p, 'F', v) && v > 0) feedrate = MMM_TO_MMS(v);
+
+      xyze_pos_t target = position;
+      LOOP_LOGICAL_AXES(i) if (param(p, AXIS_CHAR(i), v)) {
+        const bool relative = TERN0(HAS_EXTRUDERS, i == E_AXIS) ? relative_e : relative_xyz;
+        target[i] = (relative ? target[i] : 0) + v;
+      }
+
+      float length = 0;
+      #if HAS_Y_AXIS
+        if (code >= 2) {
+          // Arc length from the sweep around the center, as G2/G3 would segment it
+          const float dx = target.x - position.x, dy = target.y - position.y;
+          float radius, angle;
+          if (param(p, 'R', radius)) {
+            angle = 2.0f * asinf(_MIN(HYPOT(dx, dy) / (2.0f * ABS(radius)), 1.0f));
+            if (radius < 0) angle = RADIANS(360) - angle;
+            radius = ABS(radius);
+          }
+          else {
+            float ci = 0, cj = 0;
+            param(p, 'I', ci);
+            param(p, 'J', cj);
+            radius = HYPOT(ci, cj);
+            angle = ATAN2(dy - cj, dx - ci) - ATAN2(-cj, -ci);
+            if (code == 2) angle = -angle;
+            if (angle < 0.0001f) angle += RADIANS(360);   // Full circle if the end is the start
+          }
+          length = HYPOT(radius * angle, TERN0(HAS_Z_AXIS, target.z - position.z));
+        }
+        else
+      #endif
+        {
+          float dist_sq = 0;
+          LOOP_NUM_AXES(i) dist_sq += sq(target[i] - position[i]);
+          length = SQRT(dist_sq);
+        }
+      #if HAS_EXTRUDERS
+        if (length < 0.0001f) length = ABS(target.e - position.e);
+      #endif
+
+      if (length >= 0.0001f) move(target, length, endpos);
+      position = target;
+    } break;
+
+    case 4:                           // Dwell after the moves are done
+      flush();
+      if (param(p, 'P', v)) elapsed += v * 0.001f;
+      else if (param(p, 'S', v)) elapsed += v;
+      mark(endpos);
+      break;
+
+    case 28:                          // Homing time isn't known. Start again from zero.
+      flush();
+      LOOP_NUM_AXES(i) position[i] = 0;
+      break;
+
+    case 90: relative_xyz = relative_e = false; break;
+    case 91: relative_xyz = relative_e = true; break;
+
+    case 92:
+      LOOP_LOGICAL_AXES(i) if (param(p, AXIS_CHAR(i), v)) position[i] = v;
+      break;
+  }
+  else if (letter == 'M') switch (code) {
+    case 82: relative_e = false; break;
+    case 83: relative_e = true; break;
+
+    case 109: case 190: case 400:     // Wait for the moves to finish
+      flush();
+      break;
+
+    case 204:
+      if (param(p, 'S', v)) print_accel = travel_accel = v;
+      if (param(p, 'P', v)) print_accel = v;
+      if (param(p, 'T', v)) travel_accel = v;
+      if (param(p, 'R', v)) retract_accel = v;
+      break;
+  }
+}
+
+// Add a move to the lookahead, with the same limits as Planner::buffer_segment
+void TimeEstimate::move(const xyze_pos_t &target, const float length, const uint32_t endpos) {
+  const float inverse_mm = 1.0f / length;
+  const xyze_float_t delta = target - position;
+
+  // Requested speed and acceleration, within the limits of each axis
+  float nominal_speed = _MAX(feedrate, planner.settings.min_feedrate_mm_s, 0.1f),
+        accel = TERN0(HAS_EXTRUDERS, delta.e) ? print_accel : travel_accel;
+  bool xyz_move = false;
+  LOOP_NUM_AXES(i) if (delta[i]) xyz_move = true;
+  if (!xyz_move) accel = retract_accel;
+
+  LOOP_LOGICAL_AXES(i) if (delta[i]) {
+    const float ratio = ABS(delta[i]) * inverse_mm;
+    NOMORE(nominal_speed, planner.settings.max_feedrate_mm_s[i] / ratio);
+    NOMORE(accel, planner.settings.max_acceleration_mm_per_s2[i] / ratio);
+  }
+
+  // Junction speed from the angle with the previous move
+  xyze_float_t unit = delta;
+  float mag_sq = 0;
+  LOOP_LOGICAL_AXES(i) mag_sq += sq(unit[i]);
+  unit *= RSQRT(mag_sq);
+
+  float vmax_junction = 0;
+  if (prev_nominal_speed) {
+    float junction_cos_theta = 0;
+    LOOP_LOGICAL_AXES(i) junction_cos_theta -= prev_unit[i] * unit[i];
+    if (junction_cos_theta <= 0.999999f) {
+      NOLESS(junction_cos_theta, -0.999999f);
+      const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)),
+                  junction_deviation = TERN(HAS_JUNCTION_DEVIATION, planner.junction_deviation_mm, 0.4f * sq(planner.max_jerk.x) / accel);
+      vmax_junction = SQRT(accel * junction_deviation * sin_theta_d2 / (1.0f - sin_theta_d2));
+    }
+    NOMORE(vmax_junction, _MIN(nominal_speed, prev_nominal_speed));
+  }
+  prev_unit = unit;
+  prev_nominal_speed = nominal_speed;
+
+  if (block_count == SD_TIME_ESTIMATE_BLOCKS) retire();
+
+  sim_block_t &b = blocks[block_count++];
+  b.millimeters = length;
+  b.nominal_speed = nominal_speed;
+  b.acceleration = accel;
+  b.max_entry_speed = vmax_junction;
+  b.entry_speed = block_count > 1 ? vmax_junction : 0;
+  b.endpos = endpos;
+  plan();
+}
+
+// Entry speeds by the reverse and forward passes of the Planner, with a stop after the newest move
+void TimeEstimate::plan() {
+  float next_entry = 0;
+  for (uint8_t n = block_count; --n;) {   // The oldest entry speed is already fixed
+    sim_block_t &b = blocks[n];
+    b.entry_speed = _MIN(b.max_entry_speed, SQRT(sq(next_entry) + 2.0f * b.acceleration * b.millimeters));
+    next_entry = b.entry_speed;
+  }
+  for (uint8_t n = 1; n < block_count; ++n) {
+    const sim_block_t &prev = blocks[n - 1];
+    NOMORE(blocks[n].entry_speed, SQRT(sq(prev.entry_speed) + 2.0f * prev.acceleration * prev.millimeters));
+  }
+}
+
+// Add the time of the oldest move, as a trapezoid from its entry speed to the next one
+void TimeEstimate::retire() {
+  const sim_block_t &b = blocks[0];
+  const float v0 = b.entry_speed, v1 = block_count > 1 ? blocks[1].entry_speed : 0,
+              vn = b.nominal_speed, a = b.acceleration, L = b.millimeters,
+              accel_dist = (sq(vn) - sq(v0)) / (2.0f * a),
+              decel_dist = (sq(vn) - sq(v1)) / (2.0f * a);
+
+  if (accel_dist + decel_dist <= L)   // Reaches the nominal speed
+    elapsed += (vn - v0) / a + (vn - v1) / a + (L - accel_dist - decel_dist) / vn;
+  else {                              // Accelerates to a peak, then decelerates
+    const float vp = SQRT((2.0f * a * L + sq(v0) + sq(v1)) * 0.5f);
+    elapsed += (vp - v0) / a + (vp - v1) / a;
+  }
+
+  mark(b.endpos);
+  for (uint8_t n = 1; n < block_count; ++n) blocks[n - 1] = blocks[n];
+  --block_count;
+}
+
+// Run the lookahead to a stop, as when the Planner is synchronized
+void TimeEstimate::flush() {
+  while (block_count) retire();
+  prev_nominal_speed = 0;
+}
+
+// Set the time of the table points up to a file position
+void TimeEstimate::mark(const uint32_t pos) {
+  while (next_point < SD_TIME_ESTIMATE_POINTS && next_point * step <= pos)
+    table[next_point++] = elapsed;
+}
+
+void TimeEstimate::finish() {
+  flush();
+  while (next_point <= SD_TIME_ESTIMATE_POINTS) table[next_point++] = elapsed;
+  done = true;
+}
+
+uint32_t TimeEstimate::remaining(const uint32_t sdpos) {
+  if (!done || !step) return 0;
+  const float f = _MIN(sdpos / step, float(SD_TIME_ESTIMATE_POINTS));
+  const uint8_t k = _MIN(uint8_t(f), uint8_t(SD_TIME_ESTIMATE_POINTS - 1));
+  const float t = table[k] + (table[k + 1] - table[k]) * (f - k);
+  return LROUND((table[SD_TIME_ESTIMATE_POINTS] - t) * 100.0f / _MAX(feedrate_percentage, 1));
+}
+
+#endif // SD_TIME_ESTIMATE
@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/time_estimate.h - Print time estimate from a simulation of the media file
+ *
+ * While a file prints from media a second handle reads ahead through the whole
+ * file in idle time. Its moves go through a small planner model with the same
+ * trapezoids, junction deviation, and limits as the Planner, and each finished
+ * move adds its time to a table of print time by file position. Once the end of
+ * the file is reached the remaining time comes from the table.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  float millimeters,      // Length of the move
+        nominal_speed,    // Requested speed, within the axis limits (mm/s)
+        acceleration,     // Acceleration, within the axis limits (mm/s^2)
+        max_entry_speed,  // Junction speed limit (mm/s)
+        entry_speed;      // Planned entry speed (mm/s)
+  uint32_t endpos;        // File position after the line of the move
+} sim_block_t;
+
+class TimeEstimate {
+public:
+  // Forget the simulation and its table
+  static void reset();
+
+  // Read and simulate the next part of the printing file
+  static void idle();
+
+  // Seconds left to print at the given file position, scaled by the feedrate percentage. 0 if not known yet.
+  static uint32_t remaining(const uint32_t sdpos);
+
+  // Simulated print time of the whole file, in seconds
+  static float total() { return done ? table[SD_TIME_ESTIMATE_POINTS] : 0; }
+
+  // The simulation on its own, for a file of the given size. Used by idle() and the unit tests.
+  static void begin(const uint32_t size);
+  static void line(char * const cmd, const uint32_t endpos);
+  static void finish();
+
+private:
+  static bool done;
+  static float table[SD_TIME_ESTIMATE_POINTS + 1], step, elapsed;
+  static uint8_t next_point;
+
+  // Lookahead of simulated moves, oldest first
+  static sim_block_t blocks[SD_TIME_ESTIMATE_BLOCKS];
+  static uint8_t block_count;
+
+  // Machine state from the file
+  static xyze_pos_t position;
+  static xyze_float_t prev_unit;
+  static float feedrate, prev_nominal_speed, print_accel, travel_accel, retract_accel;
+  static bool relative_xyz, relative_e;
+
+  static void move(const xyze_pos_t &target, const float length, const uint32_t endpos);
+  static void plan();
+  static void retire();
+  static void flush();
+  static void mark(const uint32_t pos);
+};
+
+extern TimeEstimate timeEstimate;
@@ -92,7 +92,9 @@
       static uint32_t get_pwm_scale(TMC2130Stepper &st) { return st.PWM_SCALE(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2130Stepper &st) {
+    static uint32_t read_drv_status(TMC2130Stepper &st) { return st.DRV_STATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2130Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 25, OTPW_bp = 26;
       constexpr uint32_t S2G_bm = 0x18000000;
       #if ENABLED(TMC_DEBUG)
@@ -103,7 +105,7 @@
         constexpr uint8_t STST_bp = 31;
       #endif
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       #ifdef __AVR__
 
         // 8-bit optimization saves up to 70 bytes of PROGMEM per axis
@@ -153,7 +155,9 @@
       static uint32_t get_pwm_scale(TMC2240Stepper &st) { return st.PWM_SCALE(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2240Stepper &st) {
+    static uint32_t read_drv_status(TMC2240Stepper &st) { return st.DRV_STATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2240Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 25, OTPW_bp = 26;
       constexpr uint32_t S2G_bm = 0x18000000;
       #if ENABLED(TMC_DEBUG)
@@ -164,7 +168,7 @@
         constexpr uint8_t STST_bp = 31;
       #endif
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       #ifdef __AVR__
 
         // 8-bit optimization saves up to 70 bytes of PROGMEM per axis
@@ -214,11 +218,13 @@
       static uint32_t get_pwm_scale(TMC2208Stepper &st) { return st.pwm_scale_sum(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2208Stepper &st) {
+    static uint32_t read_drv_status(TMC2208Stepper &st) { return st.DRV_STATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2208Stepper &, const uint32_t ds) {
       constexpr uint8_t OTPW_bp = 0, OT_bp = 1;
       constexpr uint8_t S2G_bm = 0b111100; // 2..5
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       data.is_otpw = TEST(ds, OTPW_bp);
       data.is_ot = TEST(ds, OT_bp);
       data.is_s2g = !!(ds & S2G_bm);
@@ -251,11 +257,13 @@
       static uint32_t get_pwm_scale(TMC2660Stepper) { return 0; }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2660Stepper &st) {
+    static uint32_t read_drv_status(TMC2660Stepper &st) { return st.DRVSTATUS(); }
+
+    static TMC_driver_data get_driver_data(TMC2660Stepper &, const uint32_t ds) {
       constexpr uint8_t OT_bp = 1, OTPW_bp = 2;
       constexpr uint8_t S2G_bm = 0b11000;
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRVSTATUS();
+      data.drv_status = ds;
       uint8_t spart = ds & 0xFF;
       data.is_otpw = TEST(spart, OTPW_bp);
       data.is_ot = TEST(spart, OT_bp);
@@ -352,139 +360,296 @@
 
   #endif
 
+  /**
+   * Read DRV_STATUS from one driver and update the driver's error counters.
+   * Return 'true' if the driver current should be stepped down.
+   */
   template<typename TMC>
-  bool monitor_tmc_driver(TMC &st, const bool need_update_error_counters, const bool need_debug_reporting) {
-    TMC_driver_data data = get_driver_data(st);
-    if (data.drv_status == 0xFFFFFFFF || data.drv_status == 0x0) return false;
+  bool monitor_tmc_driver(TMC &st) {
+    const uint32_t ds = read_drv_status(st);
+    TERN_(TMC_DEBUG, st.drv_status = ds);
+    if (ds == 0xFFFFFFFF || ds == 0x0) return false;
 
-    bool should_step_down = false;
+    const TMC_driver_data data = get_driver_data(st, ds);
 
-    if (need_update_error_counters) {
-      if (data.is_ot | data.is_s2g) st.error_count++;
-      else if (st.error_count > 0) st.error_count--;
+    if (data.is_ot | data.is_s2g) st.error_count++;
+    else if (st.error_count > 0) st.error_count--;
 
-      #if ENABLED(STOP_ON_ERROR)
-        if (st.error_count >= 10) {
-          SERIAL_EOL();
-          st.printLabel();
-          report_driver_error(data);
-        }
-      #endif
+    #if ENABLED(STOP_ON_ERROR)
+      if (st.error_count >= 10) {
+        SERIAL_EOL();
+        st.printLabel();
+        report_driver_error(data);
+      }
+    #endif
 
-      // Report if a warning was triggered
-      if (data.is_otpw && st.otpw_count == 0)
-        report_driver_otpw(st);
+    // Report if a warning was triggered
+    if (data.is_otpw && st.otpw_count == 0)
+      report_driver_otpw(st);
 
-      #if CURRENT_STEP_DOWN > 0
-        // Decrease current if is_otpw is true and driver is enabled and there's been more than 4 warnings
-        if (data.is_otpw && st.otpw_count > 4 && st.isEnabled())
-          should_step_down = true;
-      #endif
+    bool should_step_down = false;
 
-      if (data.is_otpw) {
-        st.otpw_count++;
-        st.flag_otpw = true;
-      }
-      else if (st.otpw_count > 0) st.otpw_count = 0;
-    }
+    #if CURRENT_STEP_DOWN > 0
+      // Decrease current if is_otpw is true and driver is enabled and there's been more than 4 warnings
+      if (data.is_otpw && st.otpw_count > 4 && st.isEnabled())
+        should_step_down = true;
+    #endif
 
-    if (need_debug_reporting) {
-      TERN_(TMC_DEBUG, report_polled_driver_data(st, data));
+    if (data.is_otpw) {
+      st.otpw_count++;
+      st.flag_otpw = true;
     }
+    else if (st.otpw_count > 0) st.otpw_count = 0;
 
     return should_step_down;
   }
 
+  #if ENABLED(TMC_DEBUG)
+
+    // Periodic reports use the cached DRV_STATUS instead of reading all drivers again
+    template<typename TMC>
+    void report_cached_driver_data(TMC &st) {
+      if (st.drv_status == 0xFFFFFFFF || st.drv_status == 0x0) return;
+      report_polled_driver_data(st, get_driver_data(st, st.drv_status));
+    }
+
+  #endif
+
+  /**
+   * Each UART/SPI transaction blocks, so only one driver is read per call.
+   * The drivers are polled in turn, spreading a full pass over the
+   * MONITOR_DRIVER_STATUS_INTERVAL_MS period. With TMC_DEBUG each result
+   * is kept for the periodic M122 S report.
+   */
   void monitor_tmc_drivers() {
     const millis_t ms = millis();
 
-    // Poll TMC drivers at the configured interval
     static millis_t next_poll = 0;
-    const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+    static uint8_t poll_index = 0;
 
-    // Also poll at intervals for debugging
-    #if ENABLED(TMC_DEBUG)
-      static millis_t next_debug_reporting = 0;
-      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
-      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
-    #else
-      constexpr bool need_debug_reporting = false;
-    #endif
+    if (ELAPSED(ms, next_poll)) {
+      uint8_t n = 0;
+      bool step_down = false;
 
-    if (need_update_error_counters || need_debug_reporting) {
+      #define _TMC_POLL(ST) if (poll_index == n++) step_down = monitor_tmc_driver(ST)
 
       #if X_IS_TRINAMIC || X2_IS_TRINAMIC
-        if ( TERN0(X_IS_TRINAMIC, monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting))
-          || TERN0(X2_IS_TRINAMIC, monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting))
-        ) {
+        TERN_(X_IS_TRINAMIC, _TMC_POLL(stepperX));
+        TERN_(X2_IS_TRINAMIC, _TMC_POLL(stepperX2));
+        if (step_down) {
           TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
           TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
+          step_down = false;
         }
       #endif
 
       #if Y_IS_TRINAMIC || Y2_IS_TRINAMIC
-        if ( TERN0(Y_IS_TRINAMIC, monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting))
-          || TERN0(Y2_IS_TRINAMIC, monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting))
-        ) {
+        TERN_(Y_IS_TRINAMIC, _TMC_POLL(stepperY));
+        TERN_(Y2_IS_TRINAMIC, _TMC_POLL(stepperY2));
+        if (step_down) {
           TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
           TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
+          step_down = false;
         }
       #endif
 
       #if ANY(Z_IS_TRINAMIC, Z2_IS_TRINAMIC, Z3_IS_TRINAMIC, Z4_IS_TRINAMIC)
-        if ( TERN0(Z_IS_TRINAMIC,  monitor_tmc_driver(stepperZ,  need_update_error_counters, need_debug_reporting))
-          || TERN0(Z2_IS_TRINAMIC, monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z3_IS_TRINAMIC, monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z4_IS_TRINAMIC, monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting))
-        ) {
+        TERN_(Z_IS_TRINAMIC,  _TMC_POLL(stepperZ));
+        TERN_(Z2_IS_TRINAMIC, _TMC_POLL(stepperZ2));
+        TERN_(Z3_IS_TRINAMIC, _TMC_POLL(stepperZ3));
+        TERN_(Z4_IS_TRINAMIC, _TMC_POLL(stepperZ4));
+        if (step_down) {
           TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
           TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
           TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
           TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
+          step_down = false;
         }
       #endif
 
       #if I_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperI, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperI);
+        _TMC_POLL(stepperI);
+        if (step_down) { step_current_down(stepperI); step_down = false; }
       #endif
       #if J_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperJ, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperJ);
+        _TMC_POLL(stepperJ);
+        if (step_down) { step_current_down(stepperJ); step_down = false; }
       #endif
       #if K_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperK, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperK);
+        _TMC_POLL(stepperK);
+        if (step_down) { step_current_down(stepperK); step_down = false; }
       #endif
       #if U_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperU, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperU);
+        _TMC_POLL(stepperU);
+        if (step_down) { step_current_down(stepperU); step_down = false; }
       #endif
       #if V_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperV, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperV);
+        _TMC_POLL(stepperV);
+        if (step_down) { step_current_down(stepperV); step_down = false; }
       #endif
       #if W_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperW, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperW);
+        _TMC_POLL(stepperW);
+        if (step_down) { step_current_down(stepperW); step_down = false; }
       #endif
 
-      TERN_(E0_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting));
-      TERN_(E1_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting));
-      TERN_(E2_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting));
-      TERN_(E3_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting));
-      TERN_(E4_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting));
-      TERN_(E5_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting));
-      TERN_(E6_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting));
-      TERN_(E7_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting));
+      TERN_(E0_IS_TRINAMIC, _TMC_POLL(stepperE0));
+      TERN_(E1_IS_TRINAMIC, _TMC_POLL(stepperE1));
+      TERN_(E2_IS_TRINAMIC, _TMC_POLL(stepperE2));
+      TERN_(E3_IS_TRINAMIC, _TMC_POLL(stepperE3));
+      TERN_(E4_IS_TRINAMIC, _TMC_POLL(stepperE4));
+      TERN_(E5_IS_TRINAMIC, _TMC_POLL(stepperE5));
+      TERN_(E6_IS_TRINAMIC, _TMC_POLL(stepperE6));
+      TERN_(E7_IS_TRINAMIC, _TMC_POLL(stepperE7));
 
-      if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+      #undef _TMC_POLL
+
+      UNUSED(step_down);
+
+      if (++poll_index >= n) poll_index = 0;
+      next_poll = ms + (MONITOR_DRIVER_STATUS_INTERVAL_MS) / _MAX(n, 1);
     }
+
+    // Also report at intervals for debugging
+    #if ENABLED(TMC_DEBUG)
+      static millis_t next_debug_reporting = 0;
+      if (report_tmc_status_interval && ELAPSED(ms, next_debug_reporting)) {
+        next_debug_reporting = ms + report_tmc_status_interval;
+        TERN_(X_IS_TRINAMIC,  report_cached_driver_data(stepperX));
+        TERN_(X2_IS_TRINAMIC, report_cached_driver_data(stepperX2));
+        TERN_(Y_IS_TRINAMIC,  report_cached_driver_data(stepperY));
+        TERN_(Y2_IS_TRINAMIC, report_cached_driver_data(stepperY2));
+        TERN_(Z_IS_TRINAMIC,  report_cached_driver_data(stepperZ));
+        TERN_(Z2_IS_TRINAMIC, report_cached_driver_data(stepperZ2));
+        TERN_(Z3_IS_TRINAMIC, report_cached_driver_data(stepperZ3));
+        TERN_(Z4_IS_TRINAMIC, report_cached_driver_data(stepperZ4));
+        TERN_(I_IS_TRINAMIC,  report_cached_driver_data(stepperI));
+        TERN_(J_IS_TRINAMIC,  report_cached_driver_data(stepperJ));
+        TERN_(K_IS_TRINAMIC,  report_cached_driver_data(stepperK));
+        TERN_(U_IS_TRINAMIC,  report_cached_driver_data(stepperU));
+        TERN_(V_IS_TRINAMIC,  report_cached_driver_data(stepperV));
+        TERN_(W_IS_TRINAMIC,  report_cached_driver_data(stepperW));
+        TERN_(E0_IS_TRINAMIC, report_cached_driver_data(stepperE0));
+        TERN_(E1_IS_TRINAMIC, report_cached_driver_data(stepperE1));
+        TERN_(E2_IS_TRINAMIC, report_cached_driver_data(stepperE2));
+        TERN_(E3_IS_TRINAMIC, report_cached_driver_data(stepperE3));
+        TERN_(E4_IS_TRINAMIC, report_cached_driver_data(stepperE4));
+        TERN_(E5_IS_TRINAMIC, report_cached_driver_data(stepperE5));
+        TERN_(E6_IS_TRINAMIC, report_cached_driver_data(stepperE6));
+        TERN_(E7_IS_TRINAMIC, report_cached_driver_data(stepperE7));
+        SERIAL_EOL();
+      }
+    #endif
   }
 
 #endif // MONITOR_DRIVER_STATUS
 
+#if ENABLED(AUTO_REPORT_TMC_LOAD)
+
+  #include "../module/stepper.h"
+
+  AutoReporter<TMCLoadReport, TMC_LOAD_REPORT_UNIT_MS> tmc_load_auto_reporter;
+
+  /**
+   * Load sample for one driver: stallGuard result and actual current scale.
+   * A value of -1 means the driver doesn't provide that field.
+   */
+  struct tmc_load_t {
+    uint32_t drv_status;
+    int16_t sg_result;
+    int8_t cs_actual;
+  };
+
+  #if HAS_TMCX1X0
+    static tmc_load_t get_driver_load(TMC2130Stepper &st) {
+      const uint32_t ds = st.DRV_STATUS();
+      return { ds, int16_t(ds & 0x3FF), int8_t((ds >> 16) & 0x1F) };
+    }
+  #endif
+
+  #if HAS_DRIVER(TMC2240)
+    static tmc_load_t get_driver_load(TMC2240Stepper &st) {
+      const uint32_t ds = st.DRV_STATUS();
+      return { ds, int16_t(ds & 0x3FF), int8_t((ds >> 16) & 0x1F) };
+    }
+  #endif
+
+  #if HAS_TMC220x
+    static tmc_load_t get_driver_load(TMC2208Stepper &st) {
+      const uint32_t ds = st.DRV_STATUS();
+      return { ds, -1, int8_t((ds >> 16) & 0x1F) };
+    }
+    #if HAS_DRIVER(TMC2209)
+      // TMC2209 keeps SG_RESULT in its own register
+      static tmc_load_t get_driver_load(TMC2209Stepper &st) {
+        tmc_load_t load = get_driver_load(static_cast<TMC2208Stepper &>(st));
+        load.sg_result = st.SG_RESULT();
+        return load;
+      }
+    #endif
+  #endif
+
+  #if HAS_DRIVER(TMC2660)
+    // The DRVSTATUS read-out depends on DRVCONF RDSEL
+    static tmc_load_t get_driver_load(TMC2660Stepper &st) {
+      const uint32_t ds = st.DRVSTATUS();
+      switch (st.rdsel()) {
+        case 0b01: return { ds, int16_t((ds >> 10) & 0x3FF), -1 };                                // SG_RESULT[9:0]
+        case 0b10: return { ds, int16_t(((ds >> 15) & 0x1F) << 5), int8_t((ds >> 10) & 0x1F) };   // SG_RESULT[9:5], SE[4:0]
+        default:   return { ds, -1, -1 };                                                         // Microstep position
+      }
+    }
+  #endif
+
+  template<typename TMC>
+  static void report_driver_load(TMC &st) {
+    const tmc_load_t load = get_driver_load(st);
+    SERIAL_CHAR(' ');
+    st.printLabel();
+    SERIAL_CHAR(':');
+    if (load.drv_status == 0xFFFFFFFF || load.drv_status == 0x0) {
+      SERIAL_ECHOPGM("-/-");
+      return;
+    }
+    if (load.sg_result < 0) SERIAL_CHAR('-'); else SERIAL_ECHO(load.sg_result);
+    SERIAL_CHAR('/');
+    if (load.cs_actual < 0) SERIAL_CHAR('-'); else SERIAL_ECHO(int(load.cs_actual));
+  }
+
+  /**
+   * Report one compact load sample for all drivers, followed by the
+   * stepper counts so hosts can correlate load with position.
+   *
+   *   TMC_LOAD T:<ms> X:<sg_result>/<cs_actual> ... Count X:<steps> ...
+   */
+  void TMCLoadReport::report() {
+    SERIAL_ECHOPGM("TMC_LOAD T:", millis());
+    TERN_(X_IS_TRINAMIC,  report_driver_load(stepperX));
+    TERN_(X2_IS_TRINAMIC, report_driver_load(stepperX2));
+    TERN_(Y_IS_TRINAMIC,  report_driver_load(stepperY));
+    TERN_(Y2_IS_TRINAMIC, report_driver_load(stepperY2));
+    TERN_(Z_IS_TRINAMIC,  report_driver_load(stepperZ));
+    TERN_(Z2_IS_TRINAMIC, report_driver_load(stepperZ2));
+    TERN_(Z3_IS_TRINAMIC, report_driver_load(stepperZ3));
+    TERN_(Z4_IS_TRINAMIC, report_driver_load(stepperZ4));
+    TERN_(I_IS_TRINAMIC,  report_driver_load(stepperI));
+    TERN_(J_IS_TRINAMIC,  report_driver_load(stepperJ));
+    TERN_(K_IS_TRINAMIC,  report_driver_load(stepperK));
+    TERN_(U_IS_TRINAMIC,  report_driver_load(stepperU));
+    TERN_(V_IS_TRINAMIC,  report_driver_load(stepperV));
+    TERN_(W_IS_TRINAMIC,  report_driver_load(stepperW));
+    TERN_(E0_IS_TRINAMIC, report_driver_load(stepperE0));
+    TERN_(E1_IS_TRINAMIC, report_driver_load(stepperE1));
+    TERN_(E2_IS_TRINAMIC, report_driver_load(stepperE2));
+    TERN_(E3_IS_TRINAMIC, report_driver_load(stepperE3));
+    TERN_(E4_IS_TRINAMIC, report_driver_load(stepperE4));
+    TERN_(E5_IS_TRINAMIC, report_driver_load(stepperE5));
+    TERN_(E6_IS_TRINAMIC, report_driver_load(stepperE6));
+    TERN_(E7_IS_TRINAMIC, report_driver_load(stepperE7));
+    stepper.report_positions();
+  }
+
+#endif // AUTO_REPORT_TMC_LOAD
+
 #if ENABLED(TMC_DEBUG)
 
   /**
@@ -66,6 +66,11 @@ class TMCStorage {
       bool flag_otpw = false;
       bool getOTPW() { return flag_otpw; }
       void clear_otpw() { flag_otpw = 0; }
+
+      #if ENABLED(TMC_DEBUG)
+        // Last DRV_STATUS read by the driver monitor, for the periodic M122 S report
+        uint32_t drv_status = 0;
+      #endif
     #endif
 
     uint16_t getMilliamps() { return val_mA; }
@@ -391,6 +396,13 @@ class TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC266
 void monitor_tmc_drivers();
 void test_tmc_connection(LOGICAL_AXIS_DECL_LC(const bool, true));
 
+#if ENABLED(AUTO_REPORT_TMC_LOAD)
+  #include "../libs/autoreport.h"
+  #define TMC_LOAD_REPORT_UNIT_MS 50
+  struct TMCLoadReport { static void report(); };
+  extern AutoReporter<TMCLoadReport, TMC_LOAD_REPORT_UNIT_MS> tmc_load_auto_reporter;
+#endif
+
 #if ENABLED(TMC_DEBUG)
   #if ENABLED(MONITOR_DRIVER_STATUS)
     void tmc_set_report_interval(const uint16_t update_interval);
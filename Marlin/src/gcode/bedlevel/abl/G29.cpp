@@ -717,6 +717,10 @@ G29_TYPE GcodeSuite::G29() {
         // An index to print current state
         grid_count_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
 
+        #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
+          float scan_pos, scan_z; // Last good sensor reading and where it was taken
+        #endif
+
         // Inner loop is Y with PROBE_Y_FIRST enabled
         // Inner loop is X with PROBE_Y_FIRST disabled
         for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
@@ -732,59 +736,49 @@ G29_TYPE GcodeSuite::G29() {
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
           #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
-            if (PR_INNER_VAR == inStart) {
-              char tmp_1[32];
+            constexpr AxisEnum axis = TERN(PROBE_Y_FIRST, Y_AXIS, X_AXIS);
 
-              // move to the start point of new line
+            if (PR_INNER_VAR == inStart) {
+              // Move to the start point of the new line
               abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
-              // Go to the end of the row/column ... and back up by one
-              // TODO: Why not just use... PR_INNER_VAR = inStop - inInc
-              for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; PR_INNER_VAR += inInc);
-              PR_INNER_VAR -= inInc;
-
-              // Get the coordinate of the resulting grid point
-              abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
-
-              // Coordinate that puts the probe at the grid point
-              abl.probePos -= probe.offset_xy;
-
-              // Put a G1 move into the buffer
-              // TODO: Instead of G1, we can just add the move directly to the planner...
-              //  {
-              //  destination = current_position; destination = abl.probePos;
-              //  REMEMBER(fr, feedrate_mm_s, XY_PROBE_FEEDRATE_MM_S);
-              //  prepare_line_to_destination();
-              //  }
-              sprintf_P(tmp_1, PSTR("G1X%d.%d Y%d.%d F%d"),
-                int(abl.probePos.x), int(abl.probePos.x * 10) % 10,
-                int(abl.probePos.y), int(abl.probePos.y * 10) % 10,
-                XY_PROBE_FEEDRATE
-              );
-              gcode.process_subcommands_now(tmp_1);
-
-              if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("destX: ", abl.probePos.x, " Y:", abl.probePos.y);
-
-              // Reset the inner counter back to the start
-              PR_INNER_VAR = inStart;
-
-              // Get the coordinate of the start of the row/column
-              abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+
+              // Sweep to the last point of the row/column without stopping
+              destination = current_position;
+              destination = abl.probePos - probe.offset_xy;
+              destination[axis] += abl.gridSpacing[axis] * (inStop - inInc - inStart);
+              if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("destX: ", destination.x, " Y:", destination.y);
+              REMEMBER(fr, feedrate_mm_s, XY_PROBE_FEEDRATE_MM_S);
+              prepare_line_to_destination();
+
+              scan_pos = scan_z = NAN;
             }
 
-            // Wait around until the real axis position reaches the comparison point
-            // TODO: Use NEAR() because float is imprecise
-            constexpr AxisEnum axis = TERN(PROBE_Y_FIRST, Y_AXIS, X_AXIS);
+            // Sample continuously while the head moves. Each reading is tagged with
+            // the axis position at the middle of the I2C transfer, and the height at the
+            // grid point is interpolated between the readings on either side of it.
             const float cmp = abl.probePos[axis] - probe.offset_xy[axis];
-            float pos;
+            float z_at = NAN;
             for (;;) {
-              pos = planner.get_axis_position_mm(axis);
-              if (inInc > 0 ? (pos >= cmp) : (pos <= cmp)) break;
+              const float pos1 = planner.get_axis_position_mm(axis);
+              const float z = bdl.read();
+              const float pos = (pos1 + planner.get_axis_position_mm(axis)) * 0.5f;
+              const bool passed = (pos - cmp) * inInc >= -0.001f || !planner.has_blocks_queued();
+              if (!isnan(z)) {
+                if (passed) {
+                  z_at = (isnan(scan_z) || pos == scan_pos) ? z : scan_z + (z - scan_z) * (cmp - scan_pos) / (pos - scan_pos);
+                  scan_pos = pos; scan_z = z;
+                  break;
+                }
+                scan_pos = pos; scan_z = z;
+              }
+              else if (passed && !planner.has_blocks_queued()) {
+                z_at = scan_z; // Sensor error at rest. Use the last good reading, if any.
+                break;
+              }
               marlin.idle_no_sleep();
             }
-            //if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM_P(axis == Y_AXIS ? PSTR("Y=") : PSTR("X=", pos);
 
-            safe_delay(4);
-            abl.measured_z = current_position.z - bdl.read();
+            abl.measured_z = current_position.z - z_at;
             if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("x_cur ", planner.get_axis_position_mm(X_AXIS), " z ", abl.measured_z);
 
           #else // !BD_SENSOR_PROBE_NO_STOP
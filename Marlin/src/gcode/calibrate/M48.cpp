@@ -39,6 +39,212 @@
   #include "../../feature/probe_temp_comp.h"
 #endif
 
+// Move around the test point in "legs" before probing
+static void move_legs(const xy_pos_t &test_position, const uint8_t n_legs, const bool schizoid_flag, const int8_t verbose_level) {
+  // Pick a random direction, starting angle, and radius
+  const int dir = (random(0, 10) > 5.0) ? -1 : 1;  // clockwise or counter clockwise
+  float angle = random(0, 360);
+  const float radius = random(
+    #if ENABLED(DELTA)
+      int(0.1250000000 * (PRINTABLE_RADIUS)),
+      int(0.3333333333 * (PRINTABLE_RADIUS))
+    #else
+      int(5), int(0.125 * _MIN(X_BED_SIZE, Y_BED_SIZE))
+    #endif
+  );
+  if (verbose_level > 3) {
+    SERIAL_ECHOPGM("Start radius:", radius, " angle:", angle, " dir:");
+    if (dir > 0) SERIAL_CHAR('C');
+    SERIAL_ECHOLNPGM("CW");
+  }
+
+  // Move from leg to leg in rapid succession
+  for (uint8_t l = 0; l < n_legs - 1; ++l) {
+
+    // Move some distance around the perimeter
+    float delta_angle;
+    if (schizoid_flag) {
+      // The points of a 5 point star are 72 degrees apart.
+      // Skip a point and go to the next one on the star.
+      delta_angle = dir * 2.0 * 72.0;
+    }
+    else {
+      // Just move further along the perimeter.
+      delta_angle = dir * (float)random(25, 45);
+    }
+    angle += delta_angle;
+
+    // Trig functions work without clamping, but just to be safe...
+    while (angle > 360.0) angle -= 360.0;
+    while (angle < 0.0) angle += 360.0;
+
+    // Choose the next position as an offset to chosen test position
+    const xy_pos_t noz_pos = test_position - probe.offset_xy;
+    xy_pos_t next_pos = {
+      noz_pos.x + float(cos(RADIANS(angle))) * radius,
+      noz_pos.y + float(sin(RADIANS(angle))) * radius
+    };
+
+    #if ENABLED(DELTA)
+      // If the probe can't reach the point on a round bed...
+      // Simply scale the numbers to bring them closer to origin.
+      while (!probe.can_reach(next_pos)) {
+        next_pos *= 0.8f;
+        if (verbose_level > 3)
+          SERIAL_ECHOLN(F("Moving inward: X"), next_pos.x, FPSTR(SP_Y_STR), next_pos.y);
+      }
+    #elif HAS_ENDSTOPS
+      // For a rectangular bed just keep the probe in bounds
+      LIMIT(next_pos.x, X_MIN_POS, X_MAX_POS);
+      LIMIT(next_pos.y, Y_MIN_POS, Y_MAX_POS);
+    #endif
+
+    if (verbose_level > 3)
+      SERIAL_ECHOLN(F("Going to: X"), next_pos.x, FPSTR(SP_Y_STR), next_pos.y);
+
+    do_blocking_move_to_xy(next_pos);
+  } // n_legs loop
+}
+
+#if ENABLED(M48_PROBE_BENCHMARK)
+
+  static const char str_deploy[] PROGMEM = "Deploy",
+                    str_fast[]   PROGMEM = "Fast",
+                    str_slow[]   PROGMEM = "Slow",
+                    str_raise[]  PROGMEM = "Raise",
+                    str_stow[]   PROGMEM = "Stow";
+  static PGM_P const phase_name[PROBE_PHASE_COUNT] PROGMEM = { str_deploy, str_fast, str_slow, str_raise, str_stow };
+
+  // Print a histogram of the values, one line per bin
+  static void print_histogram(const float values[], const uint8_t n, const uint8_t precision) {
+    constexpr uint8_t max_bins = 8;
+    float lo = values[0], hi = values[0];
+    for (uint8_t i = 1; i < n; ++i) { NOMORE(lo, values[i]); NOLESS(hi, values[i]); }
+    const uint8_t bins = hi > lo ? max_bins : 1;
+    const float width = (hi - lo) / bins;
+    uint8_t count[max_bins] = { 0 };
+    for (uint8_t i = 0; i < n; ++i)
+      count[bins > 1 ? _MIN(uint8_t((values[i] - lo) / width), bins - 1) : 0]++;
+    for (uint8_t b = 0; b < bins; ++b) {
+      SERIAL_ECHO(F("  "), p_float_t(lo + width * b, precision), F(" |"));
+      for (uint8_t c = count[b]; c--;) SERIAL_CHAR('#');
+      SERIAL_ECHOLN(C(' '), count[b]);
+    }
+  }
+
+  /**
+   * Probe the test point n_samples times with each combination of the benchmark
+   * slow feedrates and numbers of probes. Report the time of each probing phase and the
+   * repeatability of each combination, then the fastest one that meets the target.
+   * Return false if probing failed.
+   */
+  static bool probe_benchmark(
+    const xy_pos_t &test_position, const ProbePtRaise raise_after, const uint8_t n_samples,
+    const uint8_t n_legs, const bool schizoid_flag, const int8_t verbose_level, const float target
+  ) {
+    const uint16_t slow_feedrates[] = M48_BENCHMARK_SLOW_FEEDRATES;
+    const uint8_t probe_counts[] = M48_BENCHMARK_PROBES;
+
+    SERIAL_ECHOLNPGM("Target Standard Deviation: ", p_float_t(target, 6));
+
+    float z_set[n_samples], cycle_set[n_samples];
+    uint8_t config = 0, best = 0, best_probes = 0;
+    uint16_t best_slow = 0;
+    float best_cycle = 0;
+
+    for (const uint16_t slow : slow_feedrates) {
+      if (slow >= Z_PROBE_FEEDRATE_FAST) continue; // Phase times are told apart by the slow feedrate
+
+      for (const uint8_t probes : probe_counts) {
+        ++config;
+        SERIAL_ECHOLNPGM("Config ", config, ": Fast:", Z_PROBE_FEEDRATE_FAST, " Slow:", slow, " Probes:", probes);
+
+        struct { millis_t min, max, sum; } phase_stats[PROBE_PHASE_COUNT];
+        for (auto &ps : phase_stats) { ps.min = UINT32_MAX; ps.max = ps.sum = 0; }
+
+        float z_sum = 0, min = 99999.9, max = -99999.9;
+        for (uint8_t n = 0; n < n_samples; ++n) {
+          #if HAS_STATUS_MESSAGE
+            ui.status_printf(0, F(S_FMT " %d: %d/%d"), GET_TEXT(MSG_M48_POINT), int(config), int(n + 1), int(n_samples));
+          #endif
+
+          if (n_legs) move_legs(test_position, n_legs, schizoid_flag, verbose_level);
+
+          const float pz = probe.benchmark_at_point(test_position, raise_after, slow, probes);
+          if (isnan(pz)) return false;
+
+          millis_t cycle_ms = 0;
+          for (uint8_t p = 0; p < PROBE_PHASE_COUNT; ++p) {
+            auto &ps = phase_stats[p];
+            const millis_t ms = probe.phase_ms[p];
+            NOMORE(ps.min, ms);
+            NOLESS(ps.max, ms);
+            ps.sum += ms;
+            cycle_ms += ms;
+          }
+
+          z_set[n] = pz;
+          cycle_set[n] = cycle_ms;
+          z_sum += pz;
+          NOMORE(min, pz);
+          NOLESS(max, pz);
+
+          if (verbose_level > 2)
+            SERIAL_ECHOLN(n + 1, F(" of "), n_samples, F(": z: "), p_float_t(pz, 3), F(" ms: "), cycle_ms);
+        }
+
+        const float mean = z_sum / n_samples;
+        float dev_sum = 0, cycle_sum = 0;
+        for (uint8_t n = 0; n < n_samples; ++n) {
+          dev_sum += sq(z_set[n] - mean);
+          cycle_sum += cycle_set[n];
+        }
+        const float sigma = SQRT(dev_sum / n_samples), cycle_avg = cycle_sum / n_samples;
+        const bool pass = sigma <= target;
+
+        if (verbose_level > 0) {
+          for (uint8_t p = 0; p < PROBE_PHASE_COUNT; ++p) {
+            const auto &ps = phase_stats[p];
+            SERIAL_ECHOLN(C(' '), FPSTR(pgm_read_ptr(&phase_name[p])), F(" ms Min: "), ps.min, F(" Avg: "), ps.sum / n_samples, F(" Max: "), ps.max);
+          }
+        }
+        if (verbose_level > 1) {
+          SERIAL_ECHOLNPGM(" Z:");
+          print_histogram(z_set, n_samples, 4);
+          SERIAL_ECHOLNPGM(" Cycle ms:");
+          print_histogram(cycle_set, n_samples, 0);
+        }
+        SERIAL_ECHOLN(
+          F(" Cycle ms: "), lroundf(cycle_avg), F(" Mean: "), p_float_t(mean, 6), F(" Sigma: "), p_float_t(sigma, 6),
+          F(" Range: "), p_float_t(max - min, 3), pass ? F(" Pass") : F(" Fail")
+        );
+
+        if (pass && (!best || cycle_avg < best_cycle)) {
+          best = config;
+          best_slow = slow;
+          best_probes = probes;
+          best_cycle = cycle_avg;
+        }
+      }
+    }
+
+    SERIAL_ECHOLNPGM("Finished!");
+    if (best)
+      SERIAL_ECHOLNPGM(
+        "Fastest: Config ", best, " (", lroundf(best_cycle), "ms)"
+        " Z_PROBE_FEEDRATE_SLOW:", best_slow, " MULTIPLE_PROBING:", best_probes > 1 ? best_probes : 0
+      );
+    else
+      SERIAL_ECHOLNPGM("No configuration met the target.");
+    SERIAL_EOL();
+
+    TERN_(HAS_STATUS_MESSAGE, ui.reset_status());
+
+    return true;
+  }
+
+#endif // M48_PROBE_BENCHMARK
+
 /**
  * M48: Z probe repeatability measurement function.
  *
@@ -53,6 +259,11 @@
  *     S = Schizoid (Or Star if you prefer)
  *     C = Enable probe temperature compensation (0 or 1, default 1)
  *
+ *   With M48_PROBE_BENCHMARK:
+ *     B = Benchmark each combination of the M48_BENCHMARK_* slow feedrates and probe counts,
+ *         with P samples each, timing each phase of the probing
+ *     T = Target standard deviation for the benchmark (mm, default M48_BENCHMARK_TARGET)
+ *
  * This function requires the machine to be homed before invocation.
  */
 
@@ -100,6 +311,18 @@ void GcodeSuite::M48() {
   const bool schizoid_flag = parser.boolval('S');
   if (schizoid_flag && !seen_L) n_legs = 7;
 
+  // Benchmark the probing settings instead of a single test
+  #if ENABLED(M48_PROBE_BENCHMARK)
+    const bool benchmark = parser.boolval('B');
+    const float target = parser.linearval('T', M48_BENCHMARK_TARGET);
+    if (benchmark && target <= 0) {
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("(T)arget must be greater than 0."));
+      return;
+    }
+  #else
+    constexpr bool benchmark = false;
+  #endif
+
   if (verbose_level > 0)
     SERIAL_ECHOLNPGM("M48 Z-Probe Repeatability Test");
 
@@ -142,7 +365,14 @@ void GcodeSuite::M48() {
   const float t = probe.probe_at_point(test_position, raise_after, verbose_level);
   bool probing_good = !isnan(t);
 
-  if (probing_good) {
+  #if ENABLED(M48_PROBE_BENCHMARK)
+    if (probing_good && benchmark) {
+      randomSeed(millis());
+      probing_good = probe_benchmark(test_position, raise_after, n_samples, n_legs, schizoid_flag, verbose_level, target);
+    }
+  #endif
+
+  if (probing_good && !benchmark) {
     randomSeed(millis());
 
     float sample_sum = 0.0;
@@ -154,72 +384,7 @@ void GcodeSuite::M48() {
       #endif
 
       // When there are "legs" of movement move around the point before probing
-      if (n_legs) {
-
-        // Pick a random direction, starting angle, and radius
-        const int dir = (random(0, 10) > 5.0) ? -1 : 1;  // clockwise or counter clockwise
-        float angle = random(0, 360);
-        const float radius = random(
-          #if ENABLED(DELTA)
-            int(0.1250000000 * (PRINTABLE_RADIUS)),
-            int(0.3333333333 * (PRINTABLE_RADIUS))
-          #else
-            int(5), int(0.125 * _MIN(X_BED_SIZE, Y_BED_SIZE))
-          #endif
-        );
-        if (verbose_level > 3) {
-          SERIAL_ECHOPGM("Start radius:", radius, " angle:", angle, " dir:");
-          if (dir > 0) SERIAL_CHAR('C');
-          SERIAL_ECHOLNPGM("CW");
-        }
-
-        // Move from leg to leg in rapid succession
-        for (uint8_t l = 0; l < n_legs - 1; ++l) {
-
-          // Move some distance around the perimeter
-          float delta_angle;
-          if (schizoid_flag) {
-            // The points of a 5 point star are 72 degrees apart.
-            // Skip a point and go to the next one on the star.
-            delta_angle = dir * 2.0 * 72.0;
-          }
-          else {
-            // Just move further along the perimeter.
-            delta_angle = dir * (float)random(25, 45);
-          }
-          angle += delta_angle;
-
-          // Trig functions work without clamping, but just to be safe...
-          while (angle > 360.0) angle -= 360.0;
-          while (angle < 0.0) angle += 360.0;
-
-          // Choose the next position as an offset to chosen test position
-          const xy_pos_t noz_pos = test_position - probe.offset_xy;
-          xy_pos_t next_pos = {
-            noz_pos.x + float(cos(RADIANS(angle))) * radius,
-            noz_pos.y + float(sin(RADIANS(angle))) * radius
-          };
-
-          #if ENABLED(DELTA)
-            // If the probe can't reach the point on a round bed...
-            // Simply scale the numbers to bring them closer to origin.
-            while (!probe.can_reach(next_pos)) {
-              next_pos *= 0.8f;
-              if (verbose_level > 3)
-                SERIAL_ECHOLN(F("Moving inward: X"), next_pos.x, FPSTR(SP_Y_STR), next_pos.y);
-            }
-          #elif HAS_ENDSTOPS
-            // For a rectangular bed just keep the probe in bounds
-            LIMIT(next_pos.x, X_MIN_POS, X_MAX_POS);
-            LIMIT(next_pos.y, Y_MIN_POS, Y_MAX_POS);
-          #endif
-
-          if (verbose_level > 3)
-            SERIAL_ECHOLN(F("Going to: X"), next_pos.x, FPSTR(SP_Y_STR), next_pos.y);
-
-          do_blocking_move_to_xy(next_pos);
-        } // n_legs loop
-      } // n_legs
+      if (n_legs) move_legs(test_position, n_legs, schizoid_flag, verbose_level);
 
       // Probe a single point
       const float pz = probe.probe_at_point(test_position, raise_after);
@@ -256,7 +421,7 @@ void GcodeSuite::M48() {
 
   probe.stow();
 
-  if (probing_good) {
+  if (probing_good && !benchmark) {
     SERIAL_ECHOLNPGM("Finished!");
     dev_report(verbose_level > 0, mean, sigma, min, max, true);
 
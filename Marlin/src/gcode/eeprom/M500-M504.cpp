@@ -102,6 +102,7 @@ void GcodeSuite::M502() {
         if (dowrite) {
           val = parser.byteval('V');
           persistentStore.write_data(addr, &val);
+          settings.invalidate_sections();
           SERIAL_ECHOLNPGM("Wrote address ", addr, " with ", val);
         }
         else {
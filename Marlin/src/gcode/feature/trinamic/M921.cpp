@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if ENABLED(AUTO_REPORT_TMC_LOAD)
+
+#include "../../gcode.h"
+#include "../../../feature/tmc_util.h"
+
+/**
+ * M921: Report driver load -or- set interval for auto-report
+ *
+ *   P<ms> : Set auto-report interval in milliseconds (0 to disable).
+ *           Rounded to 50ms steps with a 12750ms maximum.
+ *
+ * Each report has the format:
+ *   TMC_LOAD T:<ms> X:<sg_result>/<cs_actual> ... Count X:<steps> ...
+ */
+void GcodeSuite::M921() {
+
+  if (parser.seenval('P')) {
+    const uint16_t ms = parser.value_ushort();
+    const uint8_t units = ms ? _MAX(1U, _MIN(ms / (TMC_LOAD_REPORT_UNIT_MS), 255U)) : 0;
+    tmc_load_auto_reporter.set_interval(units, 255);
+    return;
+  }
+
+  TMCLoadReport::report();
+
+}
+
+#endif // AUTO_REPORT_TMC_LOAD
@@ -211,7 +211,7 @@ void GcodeSuite::get_destination_from_command() {
       destination.e = current_position.e;
   #endif
 
-  #if ENABLED(POWER_LOSS_RECOVERY) && !PIN_EXISTS(POWER_LOSS)
+  #if ENABLED(POWER_LOSS_RECOVERY) && (ENABLED(PLR_BACKUP_SRAM) || !PIN_EXISTS(POWER_LOSS))
     // Only update power loss recovery on moves with E
     if (recovery.enabled && card.isStillPrinting() && seen.e && (seen.x || seen.y))
       recovery.save();
@@ -1102,6 +1102,9 @@ void GcodeSuite::process_parsed_command(bool no_ok/*=false*/) {
         #if ENABLED(EDITABLE_HOMING_CURRENT)
           case 920: M920(); break;                                // M920: Set Homing Current
         #endif
+        #if ENABLED(AUTO_REPORT_TMC_LOAD)
+          case 921: M921(); break;                                // M921: Report driver load or set load auto-report interval
+        #endif
       #endif
 
       #if HAS_MICROSTEPS
@@ -145,7 +145,7 @@
  *        R<temp> Wait for extruder current temp to reach target temp. ** Wait for heating or cooling. **
  *        If AUTOTEMP is enabled, S<mintemp> B<maxtemp> F<factor>. Exit autotemp by any M109 without F
  *
- * M110 - Set / Report the current line number. (Used by host printing)
+ * M110 - Set / Report the current line number. 'M110 W1' enables windowed ok. (Used by host printing)
  * M111 - Set debug flags: 'M111 S<flagbits>'. See flag bits defined in enum.h.
  * M112 - Full Shutdown.
  *
@@ -324,6 +324,7 @@
  * M919 - Set / Report motor Chopper Times (time_off, hysteresis_end, hysteresis_start) using axis codes XYZE, etc.
  *        If no parameters are given, report. (Requires *_DRIVER_TYPE TMC(2130|2160|5130|5160|2208|2209|2240|2660))
  * M920 - Set Homing Current. (Requires distinct *_CURRENT_HOME settings)
+ * M921 - Report driver load (stallGuard / coolStep) and set the load auto-report interval. (Requires AUTO_REPORT_TMC_LOAD)
  * M936 - OTA update firmware. (Requires OTA_FIRMWARE_UPDATE)
  * M951 - Set Magnetic Parking Extruder parameters. (Requires MAGNETIC_PARKING_EXTRUDER)
  * M3426 - Read MCP3426 ADC over I2C. (Requires HAS_MCP3426_ADC)
@@ -1297,6 +1298,9 @@ private:
       static void M920();
       static void M920_report(const bool forReplay=true);
     #endif
+    #if ENABLED(AUTO_REPORT_TMC_LOAD)
+      static void M921();
+    #endif
   #endif
 
   #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM || HAS_MOTOR_CURRENT_I2C || HAS_MOTOR_CURRENT_DAC
@@ -115,6 +115,7 @@ void GcodeSuite::D(const int16_t dcode) {
           }
           SERIAL_EOL();
           persistentStore.access_finish();
+          settings.invalidate_sections();
         }
         else {
           // Read bytes from EEPROM
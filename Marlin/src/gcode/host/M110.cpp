@@ -28,6 +28,8 @@
  *
  * Parameters:
  *   N<int>  Number to set as last-processed command
+ *   W<bool> Windowed ok on this port (Requires ADVANCED_OK_WINDOW)
+ *           Reports the window limits as "Window: B<slots> L<max line length>"
  *
  * Without parameters:
  *   Report the last-processed (not last-received or last-enqueued) command
@@ -35,6 +37,15 @@
  */
 void GcodeSuite::M110() {
 
+  #if ENABLED(ADVANCED_OK_WINDOW)
+    if (parser.seen('W')) {
+      const bool onoff = parser.value_bool();
+      queue.set_windowed(queue.ring_buffer.command_port(), onoff);
+      if (onoff) SERIAL_ECHOLNPGM("Window: B", BUFSIZE, " L", MAX_CMD_SIZE - 1);
+      if (!parser.seenval('N')) return;
+    }
+  #endif
+
   if (parser.seenval('N'))
     queue.set_current_line_number(parser.value_long());
   else
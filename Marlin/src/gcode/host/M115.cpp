@@ -132,6 +132,9 @@ void GcodeSuite::M115() {
     // SERIAL_XON_XOFF
     cap_line(F("SERIAL_XON_XOFF"), ENABLED(SERIAL_XON_XOFF));
 
+    // WINDOWED_OK (M110 W1)
+    cap_line(F("WINDOWED_OK"), ENABLED(ADVANCED_OK_WINDOW));
+
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
@@ -147,6 +150,9 @@ void GcodeSuite::M115() {
     // AUTOREPORT_TEMP (M155)
     cap_line(F("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
+    // AUTOREPORT_TMC_LOAD (M921)
+    cap_line(F("AUTOREPORT_TMC_LOAD"), ENABLED(AUTO_REPORT_TMC_LOAD));
+
     // PROGRESS (M530 S L, M531 <file>, M532 X L)
     cap_line(F("PROGRESS"), false);
 
@@ -49,6 +49,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../feature/cancel_object.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -249,6 +253,20 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+  #if ENABLED(ADVANCED_OK_WINDOW)
+    SerialState &serial = serial_state[command_port().index];
+    if (serial.windowed) {
+      if (command.buffer[0] == 'N') {
+        // Hold the ok so it can acknowledge the following lines too
+        serial.acked_N = strtol(command.buffer + 1, nullptr, 10);
+        if (!serial.pending_oks++) serial.pending_ms = millis();
+        if (serial.pending_oks >= ADVANCED_OK_BATCH || length <= 1 || !planner.moves_free())
+          send_pending_ok(command_port());
+        return;
+      }
+      send_pending_ok(command_port());            // Acknowledge held lines before an unnumbered command
+    }
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
     char* p = command.buffer;
@@ -272,10 +290,54 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   SERIAL_FLUSH();
+  #if ENABLED(ADVANCED_OK_WINDOW)
+    SerialState &serial = serial_state[serial_ind.index];
+    if (serial.windowed) {
+      // The "Resend:" replaces the ok. Lines sent after the bad one are dropped until the host goes back.
+      send_pending_ok(serial_ind);
+      serial.resend_pending = true;
+      SERIAL_ECHOLNPGM(STR_RESEND, serial.last_N + 1);
+      return;
+    }
+  #endif
   SERIAL_ECHOLNPGM(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
+#if ENABLED(ADVANCED_OK_WINDOW)
+
+  void GCodeQueue::set_windowed(const serial_index_t serial_ind, const bool onoff) {
+    SerialState &serial = serial_state[serial_ind.index];
+    if (!onoff) send_pending_ok(serial_ind);
+    serial.windowed = onoff;
+    serial.resend_pending = false;
+  }
+
+  /**
+   * Acknowledge all lines processed so far with a single
+   * "ok N<int> P<int> B<int>" for the last of them.
+   */
+  void GCodeQueue::send_pending_ok(const serial_index_t serial_ind) {
+    SerialState &serial = serial_state[serial_ind.index];
+    if (!serial.pending_oks) return;
+    serial.pending_oks = 0;
+    PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+    SERIAL_ECHOPGM(STR_OK " N", serial.acked_N);
+    SERIAL_ECHOLNPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - ring_buffer.length);
+  }
+
+  // Also runs in idle(), so a long command doesn't hold back the oks of earlier lines
+  void GCodeQueue::send_stale_oks() {
+    const millis_t ms = millis();
+    for (uint8_t p = 0; p < NUM_SERIAL; ++p) {
+      const SerialState &serial = serial_state[p];
+      if (serial.pending_oks && ELAPSED(ms, serial.pending_ms + ADVANCED_OK_BATCH_MS))
+        send_pending_ok(p);
+    }
+  }
+
+#endif // ADVANCED_OK_WINDOW
+
 static bool serial_data_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if ENABLED(RX_BUFFER_MONITOR) && RX_BUFFER_SIZE
@@ -487,6 +549,8 @@ void GCodeQueue::get_serial_commands() {
           if (gcode_N != serial.last_N + 1 && !M110) {
             // A request-for-resend line was already in transit so we got two - oops!
             if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
+            // Lines sent before the host got "Resend:" are dropped quietly
+            if (TERN0(ADVANCED_OK_WINDOW, serial.resend_pending)) continue;
             // A corrupted line or too high, indicating a lost line
             gcode_line_error(F(STR_ERR_LINE_NO), p);
             break;
@@ -507,6 +571,7 @@ void GCodeQueue::get_serial_commands() {
           }
 
           serial.last_N = gcode_N;
+          TERN_(ADVANCED_OK_WINDOW, serial.resend_pending = false);
         }
         #if HAS_MEDIA
           // Pronterface "M29" and "M29 " has no line number
@@ -570,8 +635,19 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!card.isStillFetching()) return;
 
+    // M486 lines read earlier have run, so the canceled objects are up to date
+    TERN_(CANCEL_OBJECTS, if (ring_buffer.empty()) cancelable.ingest.hold = false);
+
     int sd_count = 0;
-    while (!ring_buffer.full() && !card.eof()) {
+    #if ENABLED(CANCEL_OBJECTS)
+      // Dropped lines don't fill the buffer, so return now and then to keep idle() running
+      constexpr uint8_t max_dropped = 32;
+      uint8_t dropped = 0;
+    #endif
+    // With dropped moves pending, a new line needs room for their E and F too
+    while (!ring_buffer.full(TERN0(CANCEL_OBJECTS, !sd_count && cancelable.ingest_pending()) ? 2 : 1) && !card.eof()
+      && TERN1(CANCEL_OBJECTS, dropped < max_dropped)
+    ) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -583,7 +659,14 @@ void GCodeQueue::get_serial_commands() {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+        const bool got_line = !process_line_done(sd_input_state, command.buffer, sd_count);
+        #if ENABLED(CANCEL_OBJECTS)
+          const bool drop = got_line && cancelable.ingest_line(command.buffer); // Drop moves of canceled objects
+          if (drop) ++dropped;
+        #else
+          constexpr bool drop = false;
+        #endif
+        if (got_line && !drop) {
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
           TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
@@ -595,6 +678,17 @@ void GCodeQueue::get_serial_commands() {
               card.pauseSDPrint();
           #endif
 
+          #if ENABLED(CANCEL_OBJECTS)
+            if (cancelable.ingest_pending()) {
+              // Queue the E and F of dropped moves, then move this line to the next slot
+              char line[MAX_CMD_SIZE];
+              strcpy(line, command.buffer);
+              cancelable.ingest_flush(command.buffer);
+              ring_buffer.commit_command(true);
+              strcpy(ring_buffer.commands[ring_buffer.index_w].buffer, line);
+            }
+          #endif
+
           // Put the new command into the buffer (no "ok" sent)
           ring_buffer.commit_command(true);
 
@@ -602,7 +696,16 @@ void GCodeQueue::get_serial_commands() {
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
         }
 
-        if (card.eof()) card.fileHasFinished();         // Handle end of file reached
+        if (card.eof()) {
+          #if ENABLED(CANCEL_OBJECTS)
+            // Queue the E and F of moves dropped at the end of the file
+            if (cancelable.ingest_pending()) {
+              cancelable.ingest_flush(command.buffer);
+              ring_buffer.commit_command(true);
+            }
+          #endif
+          card.fileHasFinished();                       // Handle end of file reached
+        }
       }
       else
         process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
@@ -618,6 +721,8 @@ void GCodeQueue::get_serial_commands() {
  *  - The SD card file being actively printed
  */
 void GCodeQueue::get_available_commands() {
+  TERN_(ADVANCED_OK_WINDOW, send_stale_oks());
+
   if (ring_buffer.full()) return;
 
   get_serial_commands();
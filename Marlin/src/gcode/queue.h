@@ -43,6 +43,13 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(ADVANCED_OK_WINDOW)
+      bool windowed;                //!< Acknowledge numbered lines in batches (M110 W1)
+      bool resend_pending;          //!< Drop lines still in flight until the requested line arrives
+      uint8_t pending_oks;          //!< Lines processed but not yet acknowledged
+      long acked_N;                 //!< The last line processed, acknowledged by the next ok
+      millis_t pending_ms;          //!< When the oldest unacknowledged line was processed
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -197,6 +204,18 @@ public:
    */
   static void ok_to_send() { ring_buffer.ok_to_send(); }
 
+  #if ENABLED(ADVANCED_OK_WINDOW)
+    /**
+     * Windowed acknowledgment. The host keeps several numbered lines in flight
+     * and "ok N<int>" acknowledges all lines up to N. Oks are sent after
+     * ADVANCED_OK_BATCH lines, when the queue runs dry, when the planner is
+     * full, or ADVANCED_OK_BATCH_MS after the oldest unacknowledged line.
+     */
+    static void set_windowed(const serial_index_t serial_ind, const bool onoff);
+    static void send_pending_ok(const serial_index_t serial_ind);
+    static void send_stale_oks();
+  #endif
+
   /**
    * Clear the serial line and request a resend of
    * the next expected line number.
@@ -40,13 +40,17 @@
  *
  * With M20_TIMESTAMP_SUPPORT:
  *   T<bool> - Include timestamps
+ *
+ * With MEDIA_FILE_INDEX:
+ *   I<bool> - Include the print time, filament, and size of indexed files
  */
 void GcodeSuite::M20() {
   if (card.flag.mounted) {
     SERIAL_ECHOLNPGM(STR_BEGIN_FILE_LIST);
     card.ls(TERN0(CUSTOM_FIRMWARE_UPLOAD,     parser.boolval('F') << LS_ONLY_BIN)
           | TERN0(LONG_FILENAME_HOST_SUPPORT, parser.boolval('L') << LS_LONG_FILENAME)
-          | TERN0(M20_TIMESTAMP_SUPPORT,      parser.boolval('T') << LS_TIMESTAMP));
+          | TERN0(M20_TIMESTAMP_SUPPORT,      parser.boolval('T') << LS_TIMESTAMP)
+          | TERN0(MEDIA_FILE_INDEX,           parser.boolval('I') << LS_FILE_INDEX));
     SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
   }
   else
@@ -22,6 +22,7 @@
 
 #include "../gcode.h"
 #include "../../module/temperature.h"
+#include "../../core/report_buffer.h"
 
 /**
  * M105: Read hot end and bed temperature
@@ -31,17 +32,16 @@ void GcodeSuite::M105() {
   const int8_t target_extruder = get_target_extruder_from_command();
   if (target_extruder < 0) return;
 
-  SERIAL_ECHOPGM(STR_OK);
-
   #if HAS_TEMP_SENSOR
 
-    thermalManager.print_heater_states(target_extruder OPTARG(HAS_TEMP_REDUNDANT, parser.boolval('R')));
-
-    SERIAL_EOL();
+    ReportBuffer rb;
+    rb.add(F(STR_OK));
+    thermalManager.add_heater_states(rb, target_extruder OPTARG(HAS_TEMP_REDUNDANT, parser.boolval('R')));
+    rb.eol().send();
 
   #else
 
-    SERIAL_ECHOLNPGM(" T:0"); // Some hosts send M105 to test the serial connection
+    SERIAL_ECHOLNPGM(STR_OK, " T:0"); // Some hosts send M105 to test the serial connection
 
   #endif
 }
@@ -413,6 +413,7 @@
   #undef Z_MIN_PROBE_ENDSTOP_HIT_STATE
   #undef USE_PROBE_FOR_Z_HOMING
   #undef Z_MIN_PROBE_REPEATABILITY_TEST
+  #undef M48_PROBE_BENCHMARK
   #undef HOMING_Z_WITH_PROBE
   #undef Z_CLEARANCE_MULTI_PROBE
   #undef Z_PROBE_ERROR_TOLERANCE
@@ -450,9 +451,6 @@
  */
 #if ENABLED(AUTO_BED_LEVELING_UBL)
   #undef LCD_BED_LEVELING
-  #if ANY(DELTA, SEGMENT_LEVELED_MOVES)
-    #define UBL_SEGMENTED 1
-  #endif
 #endif
 #if ANY(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_3POINT)
   #define ABL_PLANAR 1
@@ -616,6 +614,11 @@
   #endif
 #endif
 
+// Cartesian UBL without SEGMENT_LEVELED_MOVES walks the mesh cells instead
+#if ENABLED(AUTO_BED_LEVELING_UBL) && (IS_KINEMATIC || ENABLED(SEGMENT_LEVELED_MOVES))
+  #define UBL_SEGMENTED 1
+#endif
+
 #if DISABLED(DELTA)
   #undef DELTA_HOME_TO_SAFE_ZONE
 #endif
@@ -221,6 +221,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
 
+#if ENABLED(ADVANCED_OK_WINDOW) && !WITHIN(ADVANCED_OK_BATCH, 1, BUFSIZE)
+  #error "ADVANCED_OK_BATCH must be between 1 and BUFSIZE."
+#endif
+
 // Serial DMA is only available for some STM32 MCUs, HC32 and GD32
 #if ENABLED(SERIAL_DMA)
   #if ANY(ARDUINO_ARCH_HC32, ARDUINO_ARCH_MFL)
@@ -359,6 +363,18 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "SET_PROGRESS_MANUALLY requires at least one of SET_PROGRESS_PERCENT, SET_REMAINING_TIME, SET_INTERACTION_TIME to be enabled."
 #endif
 
+#if ENABLED(SD_TIME_ESTIMATE)
+  #if !HAS_MEDIA
+    #error "SD_TIME_ESTIMATE requires SDSUPPORT."
+  #elif !HAS_PRINT_PROGRESS || NONE(SHOW_REMAINING_TIME, SET_PROGRESS_MANUALLY)
+    #error "SD_TIME_ESTIMATE requires a display that shows the Remaining Time."
+  #elif !WITHIN(SD_TIME_ESTIMATE_POINTS, 2, 255)
+    #error "SD_TIME_ESTIMATE_POINTS must be from 2 to 255."
+  #elif !WITHIN(SD_TIME_ESTIMATE_BLOCKS, 2, 64)
+    #error "SD_TIME_ESTIMATE_BLOCKS must be from 2 to 64."
+  #endif
+#endif
+
 #if HAS_LCDPRINT && HAS_EXTRA_PROGRESS && LCD_HEIGHT < 4
   #error "Displays with fewer than 4 rows can't show progress values (e.g., SHOW_PROGRESS_PERCENT, SHOW_ELAPSED_TIME, SHOW_REMAINING_TIME, SHOW_INTERACTION_TIME)."
 #endif
@@ -1612,6 +1628,18 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
 
   static_assert(Z_PROBE_LOW_POINT <= 0, "Z_PROBE_LOW_POINT must be less than or equal to 0.");
 
+  #if ENABLED(M48_PROBE_BENCHMARK)
+    #if DISABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
+      #error "M48_PROBE_BENCHMARK requires Z_MIN_PROBE_REPEATABILITY_TEST."
+    #elif !PROUI_EX
+      #error "M48_PROBE_BENCHMARK requires PROUI_EX for run-time probe settings."
+    #elif ENABLED(BD_SENSOR)
+      #error "M48_PROBE_BENCHMARK is not compatible with BD_SENSOR."
+    #elif !defined(M48_BENCHMARK_SLOW_FEEDRATES) || !defined(M48_BENCHMARK_PROBES) || !defined(M48_BENCHMARK_TARGET)
+      #error "M48_PROBE_BENCHMARK requires M48_BENCHMARK_SLOW_FEEDRATES, M48_BENCHMARK_PROBES, and M48_BENCHMARK_TARGET."
+    #endif
+  #endif
+
   #if ENABLED(PROBE_ACTIVATION_SWITCH)
     #ifndef PROBE_ACTIVATION_SWITCH_STATE
       #error "PROBE_ACTIVATION_SWITCH_STATE is required for PROBE_ACTIVATION_SWITCH."
@@ -3841,6 +3869,10 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif ALL(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(PLR_BACKUP_SRAM) && (DISABLED(HAL_STM32) || NONE(STM32F4xx, STM32F7xx))
+    #error "PLR_BACKUP_SRAM requires an STM32F4 or STM32F7 with battery-backed SRAM."
+  #elif ALL(PLR_BACKUP_SRAM, SRAM_EEPROM_EMULATION)
+    #error "PLR_BACKUP_SRAM and SRAM_EEPROM_EMULATION can't both use the backup SRAM."
   #endif
 #endif
 
@@ -4110,6 +4142,14 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "MONITOR_DRIVER_STATUS and SDSUPPORT cannot be used together on boards with shared SPI."
 #endif
 
+#if ENABLED(STEP_TIMER_PULSE)
+  #if DISABLED(HAL_STM32)
+    #error "STEP_TIMER_PULSE requires an STM32 HAL."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "STEP_TIMER_PULSE is incompatible with I2S_STEPPER_STREAM."
+  #endif
+#endif
+
 // Although it just toggles STEP, EDGE_STEPPING requires HIGH state for logic
 #if ENABLED(EDGE_STEPPING)
   #if AXIS_HAS_DEDGE(X) && STEP_STATE_X != HIGH
@@ -40,11 +40,108 @@ uint8_t dwinBufTail[4] = { 0xCC, 0x33, 0xC3, 0x3C };
 uint8_t databuf[26] = { 0 };
 bool need_lcd_update = true;
 
+#if HAS_DWIN_TX_QUEUE
+
+  /**
+   * Commands are copied into a ring buffer and moved into the serial TX buffer
+   * only as space allows, so drawing a screen no longer stalls the main loop.
+   * The UART interrupt sends the bytes. Anything that talks to the display
+   * directly, or waits for it, must call dwinTxFlush() first.
+   */
+  static uint8_t tx_queue[DWIN_TX_QUEUE_SIZE];
+  static uint16_t tx_head, tx_tail;       // Write and read indexes
+  static uint16_t last_frame;             // Start of the most recent queued command, for coalescing
+
+  static_assert(DWIN_TX_QUEUE_SIZE > sizeof(dwinSendBuf) + sizeof(dwinBufTail), "DWIN_TX_QUEUE_SIZE is too small for the largest DWIN command.");
+
+  #if ENABLED(DWIN_TX_STATS)
+    static struct {
+      uint32_t bytes, frames, coalesced, stalls;
+      uint16_t frame_bytes, max_frame_bytes;
+      millis_t next_report_ms;
+    } tx_stats;
+  #endif
+
+  inline uint16_t tx_used() { return (tx_head + DWIN_TX_QUEUE_SIZE - tx_tail) % DWIN_TX_QUEUE_SIZE; }
+  inline uint16_t tx_free() { return DWIN_TX_QUEUE_SIZE - 1 - tx_used(); }
+
+  inline void tx_put(const uint8_t b) {
+    tx_queue[tx_head] = b;
+    tx_head = (tx_head + 1) % DWIN_TX_QUEUE_SIZE;
+  }
+
+  inline void tx_write_one() {
+    LCD_SERIAL.write(tx_queue[tx_tail]);
+    tx_tail = (tx_tail + 1) % DWIN_TX_QUEUE_SIZE;
+  }
+
+  void dwinTxService() {
+    for (uint16_t room = LCD_SERIAL_TX_BUFFER_FREE(); room && tx_used(); --room) tx_write_one();
+
+    #if ENABLED(DWIN_TX_STATS)
+      const millis_t ms = millis();
+      if (ELAPSED(ms, tx_stats.next_report_ms)) {
+        tx_stats.next_report_ms = ms + 10000UL;
+        if (tx_stats.frames) {
+          SERIAL_ECHOLNPGM("DWIN TX bytes/frame avg:", tx_stats.bytes / tx_stats.frames, " max:", tx_stats.max_frame_bytes,
+                           " frames:", tx_stats.frames, " coalesced:", tx_stats.coalesced, " stalls:", tx_stats.stalls);
+          const uint16_t pending = tx_stats.frame_bytes;
+          tx_stats = {};
+          tx_stats.frame_bytes = pending;
+          tx_stats.next_report_ms = ms + 10000UL;
+        }
+      }
+    #endif
+  }
+
+  void dwinTxFlush() {
+    while (tx_used()) tx_write_one();
+  }
+
+  // Can the command in dwinSendBuf be sent twice with the same result as once?
+  // Area Move (0x09) shifts pixels and an XOR fill (0x05 mode 2) reverses them.
+  static bool frame_is_idempotent() {
+    switch (dwinSendBuf[1]) {
+      case 0x09: return false;
+      case 0x05: return dwinSendBuf[2] != 2;
+      default: return true;
+    }
+  }
+
+  // Is the last queued command still unsent and identical to the 'len' bytes in dwinSendBuf?
+  static bool last_frame_pending_equals(const uint16_t len) {
+    const uint16_t frame_len = len + sizeof(dwinBufTail);
+    if (frame_len > tx_used() || (tx_head + DWIN_TX_QUEUE_SIZE - last_frame) % DWIN_TX_QUEUE_SIZE != frame_len) return false;
+    for (uint16_t n = 0; n < len; ++n)
+      if (tx_queue[(last_frame + n) % DWIN_TX_QUEUE_SIZE] != dwinSendBuf[n]) return false;
+    return true;
+  }
+
+#endif // HAS_DWIN_TX_QUEUE
+
 // Send the data in the buffer plus the packet tail
 void dwinSend(size_t &i) {
   ++i;
-  for (uint8_t n = 0; n < i; ++n) { LCD_SERIAL.write(dwinSendBuf[n]); delayMicroseconds(1); }
-  for (uint8_t n = 0; n < 4; ++n) { LCD_SERIAL.write(dwinBufTail[n]); delayMicroseconds(1); }
+  #if HAS_DWIN_TX_QUEUE
+    // Drop a redraw identical to the command still waiting at the end of the queue
+    if (frame_is_idempotent() && last_frame_pending_equals(i)) {
+      TERN_(DWIN_TX_STATS, tx_stats.coalesced++);
+      return;
+    }
+    const uint16_t len = i + sizeof(dwinBufTail);
+    if (tx_free() < len) {
+      TERN_(DWIN_TX_STATS, tx_stats.stalls++);
+      while (tx_free() < len) tx_write_one(); // Wait for the UART
+    }
+    last_frame = tx_head;
+    for (uint8_t n = 0; n < i; ++n) tx_put(dwinSendBuf[n]);
+    for (uint8_t n = 0; n < sizeof(dwinBufTail); ++n) tx_put(dwinBufTail[n]);
+    TERN_(DWIN_TX_STATS, tx_stats.frame_bytes += len);
+    dwinTxService();
+  #else
+    for (uint8_t n = 0; n < i; ++n) { LCD_SERIAL.write(dwinSendBuf[n]); delayMicroseconds(1); }
+    for (uint8_t n = 0; n < 4; ++n) { LCD_SERIAL.write(dwinBufTail[n]); delayMicroseconds(1); }
+  #endif
   need_lcd_update = true;
 }
 
@@ -63,6 +160,7 @@ bool dwinHandshake() {
   size_t i = 0;
   dwinByte(i, 0x00);
   dwinSend(i);
+  dwinTxFlush();
   delay(10);
 
   while (LCD_SERIAL.available() > 0 && recnum < (signed)sizeof(databuf)) {
@@ -115,6 +213,12 @@ void dwinUpdateLCD() {
     dwinByte(i, 0x3D);
     dwinSend(i);
     need_lcd_update = false;
+    #if HAS_DWIN_TX_QUEUE && ENABLED(DWIN_TX_STATS)
+      tx_stats.bytes += tx_stats.frame_bytes;
+      NOLESS(tx_stats.max_frame_bytes, tx_stats.frame_bytes);
+      tx_stats.frame_bytes = 0;
+      tx_stats.frames++;
+    #endif
   }
 }
 
@@ -70,6 +70,17 @@ inline void dwinLong(size_t &i, const uint32_t lval) {
 // Send the data in the buffer plus the packet tail
 void dwinSend(size_t &i);
 
+#if defined(DWIN_TX_QUEUE_SIZE) && defined(LCD_SERIAL_TX_BUFFER_FREE)
+  #define HAS_DWIN_TX_QUEUE 1
+  // Move queued commands into the serial TX buffer without blocking
+  void dwinTxService();
+  // Send all queued commands, waiting for room in the serial TX buffer
+  void dwinTxFlush();
+#else
+  inline void dwinTxService() {}
+  inline void dwinTxFlush() {}
+#endif
+
 inline void dwinText(size_t &i, const char * const string, uint16_t rlimit=0xFFFF) {
   if (!string) return;
   const size_t len = _MIN(sizeof(dwinSendBuf) - i, _MIN(strlen(string), rlimit));
@@ -104,6 +104,13 @@
 
 #if HAS_GCODE_PREVIEW
   #include "gcode_preview.h"
+  #ifdef PREVIEW_THUMB_CACHE
+    #include "thumbnail.h"
+  #endif
+#endif
+
+#if ALL(HAS_MEDIA, MEDIA_FILE_INDEX)
+  #include "file_index.h"
 #endif
 
 #if HAS_TOOLBAR
@@ -475,31 +482,73 @@ void gotoMainMenu() {
   dwinUpdateLCD();
 }
 
+// Dashboard fields, redrawn a few at a time as they change
+DWINUI::Widget dashX( 27, 459, font8x16), dashY(112, 459, font8x16), dashZ(197, 459, font8x16);
+DWINUI::Widget * const dashAxes[] = { &dashX, &dashY, &dashZ };
+
+#if HAS_HOTEND
+  DWINUI::Widget dashHotend(28, 384, DWIN_FONT_STAT), dashHotendTarget(25 + 4 * DASH_CHR_W + 6, 384, DWIN_FONT_STAT),
+                 dashFlow(116 + 2 * DASH_CHR_W, 417, DWIN_FONT_STAT);
+#endif
+#if HAS_HEATED_BED
+  DWINUI::Widget dashBed(28, 417, DWIN_FONT_STAT), dashBedTarget(25 + 4 * DASH_CHR_W + 6, 417, DWIN_FONT_STAT);
+#endif
+DWINUI::Widget dashFeedrate(116 + 2 * DASH_CHR_W, 384, DWIN_FONT_STAT);
+#if ENABLED(SHOW_SPEED_IND)
+  DWINUI::Widget dashFeedrateUnit(116 + 4 * DASH_CHR_W + 2, 384, DWIN_FONT_STAT);
+#endif
+#if HAS_FAN
+  DWINUI::Widget dashFan(195 + 2 * DASH_CHR_W, 384, DWIN_FONT_STAT);
+#endif
+DWINUI::Widget dashZOffset(204, 417, DWIN_FONT_STAT);
+
+DWINUI::Widget * const dashValues[] = {
+  #if HAS_HOTEND
+    &dashHotend, &dashHotendTarget, &dashFlow,
+  #endif
+  #if HAS_HEATED_BED
+    &dashBed, &dashBedTarget,
+  #endif
+  &dashFeedrate,
+  #if ENABLED(SHOW_SPEED_IND)
+    &dashFeedrateUnit,
+  #endif
+  #if HAS_FAN
+    &dashFan,
+  #endif
+  &dashZOffset
+};
+
+// Most dashboard fields sent to the display per UI update
+#define DASH_WIDGET_BUDGET 2
+
+// Set by dwinDrawDashboard, cleared when a full-screen frame covers the dashboard
+bool dashVisible = false;
+
+void drawDashWidgets(const uint8_t budget=UINT8_MAX) {
+  if (!dashVisible) return;
+  const uint8_t left = DWINUI::drawWidgets(dashAxes, COUNT(dashAxes), hmiData.colorCoordinate, hmiData.colorBackground, budget);
+  if (TERN1(CV_LASER_MODULE, !laser_device.is_laser_device()))
+    DWINUI::drawWidgets(dashValues, COUNT(dashValues), hmiData.colorIndicator, hmiData.colorBackground, left);
+}
+
 // Draw X, Y, Z and blink if in an un-homed or un-trusted state
-void _update_axis_value(const AxisEnum axis, const uint16_t x, const uint16_t y, const bool force) {
+void _update_axis_value(DWINUI::Widget &w, const AxisEnum axis) {
   const bool draw_qmark = axis_should_home(axis),
              draw_empty = NONE(HOME_AFTER_DEACTIVATE, DISABLE_REDUCED_ACCURACY_WARNING) && !draw_qmark && !axis_is_trusted(axis);
 
-  // Check for a position change
-  static xyz_pos_t oldpos = { -1, -1, -1 };
-
   #if ALL(IS_FULL_CARTESIAN, SHOW_REAL_POS)
     const float p = planner.get_axis_position_mm(axis);
   #else
     const float p = current_position[axis];
   #endif
 
-  const bool changed = oldpos[axis] != p;
-  if (changed) oldpos[axis] = p;
-
-  if (force || changed || draw_qmark || draw_empty) {
-    if (blink && draw_qmark)
-      DWINUI::drawString(hmiData.colorCoordinate, hmiData.colorBackground, x, y, F("  - ? -"));
-    else if (blink && draw_empty)
-      DWINUI::drawString(hmiData.colorCoordinate, hmiData.colorBackground, x, y, F("       "));
-    else
-      DWINUI::drawSignedFloat(hmiData.colorCoordinate, hmiData.colorBackground, 3, 2, x, y, p);
-  }
+  if (blink && draw_qmark)
+    w.set(F("  - ? -"));
+  else if (blink && draw_empty)
+    w.set(F("       "));
+  else
+    w.setFloat(3, 2, p, true);
 }
 
 void _drawIconBlink(bool &flag, const bool sensor, const uint8_t icon1, const uint8_t icon2, const uint16_t x, const uint16_t y) {
@@ -554,108 +603,78 @@ void _drawZOffsetIcon() {
   }
 #endif
 
-void _drawFeedrate() {
+void _setFeedrate() {
   #if ENABLED(SHOW_SPEED_IND)
-    int16_t _value;
-    if (blink) {
-      _value = feedrate_percentage;
-      DWINUI::drawString(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 116 + 4 * DASH_CHR_W + 2, 384, F(" %"));
-    }
-    else {
-      _value = round(MMS_SCALED(feedrate_mm_s));
-      dwinDrawBox(1, hmiData.colorBackground, 116 + 5 * DASH_CHR_W + 2, 384, 20, 20);
-    }
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 116 + 2 * DASH_CHR_W, 384, _value);
+    dashFeedrate.setInt(3, blink ? feedrate_percentage : int16_t(round(MMS_SCALED(feedrate_mm_s))));
+    dashFeedrateUnit.set(blink ? F(" %") : F("  "));
   #else
-    static int16_t _feedrate = 100;
-    if (_feedrate != feedrate_percentage) {
-      _feedrate = feedrate_percentage;
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 116 + 2 * DASH_CHR_W, 384, _feedrate);
-    }
+    dashFeedrate.setInt(3, feedrate_percentage);
   #endif
 }
 
 void _drawXYZPosition(const bool force) {
-  _update_axis_value(X_AXIS,  27, 459, force);
-  _update_axis_value(Y_AXIS, 112, 459, force);
-  _update_axis_value(Z_AXIS, 197, 459, force);
+  _update_axis_value(dashX, X_AXIS);
+  _update_axis_value(dashY, Y_AXIS);
+  _update_axis_value(dashZ, Z_AXIS);
+  if (force) {
+    DWINUI::invalidateWidgets(dashAxes, COUNT(dashAxes));
+    DWINUI::drawWidgets(dashAxes, COUNT(dashAxes), hmiData.colorCoordinate, hmiData.colorBackground);
+  }
 }
 
-void updateVariable() {
-  TERN_(DEBUG_DWIN,DWINUI::drawInt(COLOR_LIGHT_RED, COLOR_BG_BLACK, 2, DWIN_WIDTH-6*DWINUI::fontWidth(), 6, checkkey));
-  TERN_(DEBUG_DWIN,DWINUI::drawInt(COLOR_YELLOW, COLOR_BG_BLACK, 2, DWIN_WIDTH-3*DWINUI::fontWidth(), 6, last_checkkey));
+// Flags returned by _setDashValues for values also shown in the Tune menu
+enum DashChange : uint8_t {
+  DASH_NEW_HOTEND_TARGET = _BV(0),
+  DASH_NEW_BED_TARGET    = _BV(1),
+  DASH_NEW_FAN_SPEED     = _BV(2)
+};
 
-  _drawXYZPosition(false);
-
-  TERN_(CV_LASER_MODULE, if (laser_device.is_laser_device()) return);
+// Set the bottom dashboard values. They are drawn by drawDashWidgets().
+uint8_t _setDashValues() {
+  uint8_t changed = 0;
 
   #if HAS_HOTEND
-    static celsius_t _hotendtemp = 0, _hotendtarget = 0;
-    const celsius_t hc = thermalManager.wholeDegHotend(EXT),
-                    ht = thermalManager.degTargetHotend(EXT);
-    const bool _new_hotend_temp = _hotendtemp != hc,
-               _new_hotend_target = _hotendtarget != ht;
-    if (_new_hotend_temp) _hotendtemp = hc;
-    if (_new_hotend_target) _hotendtarget = ht;
+    dashHotend.setInt(3, thermalManager.wholeDegHotend(EXT));
+    if (dashHotendTarget.setInt(3, thermalManager.degTargetHotend(EXT))) changed |= DASH_NEW_HOTEND_TARGET;
+    dashFlow.setInt(3, planner.flow_percentage[EXT]);
   #endif
   #if HAS_HEATED_BED
-    static celsius_t _bedtemp = 0, _bedtarget = 0;
-    const celsius_t bc = thermalManager.wholeDegBed(),
-                    bt = thermalManager.degTargetBed();
-    const bool _new_bed_temp = _bedtemp != bc,
-               _new_bed_target = _bedtarget != bt;
-    if (_new_bed_temp) _bedtemp = bc;
-    if (_new_bed_target) _bedtarget = bt;
+    dashBed.setInt(3, thermalManager.wholeDegBed());
+    if (dashBedTarget.setInt(3, thermalManager.degTargetBed())) changed |= DASH_NEW_BED_TARGET;
   #endif
   #if HAS_FAN
-    static uint8_t _fanspeed = 0;
-    const bool _new_fanspeed = _fanspeed != thermalManager.fan_speed[FAN];
-    if (_new_fanspeed) _fanspeed = thermalManager.fan_speed[FAN];
+    if (dashFan.setInt(3, thermalManager.fan_speed[FAN])) changed |= DASH_NEW_FAN_SPEED;
   #endif
 
-  if (isMenu(tuneMenu) || isMenu(temperatureMenu)) {
-    // Tune page temperature update
-    TERN_(HAS_HOTEND, if (_new_hotend_target) redrawItem(hotendTargetItem));
-    TERN_(HAS_HEATED_BED, if (_new_bed_target) redrawItem(bedTargetItem));
-    TERN_(HAS_FAN, if (_new_fanspeed) redrawItem(fanSpeedItem));
-  }
+  _setFeedrate();
 
-  // Bottom temperature update
+  dashZOffset.setFloat(2, 2, BABY_Z_VAR, true);
 
-  #if HAS_HOTEND
-    if (_new_hotend_temp)
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 28, 384, _hotendtemp);
-    if (_new_hotend_target)
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 25 + 4 * DASH_CHR_W + 6, 384, _hotendtarget);
-    _drawHotendIcon();
+  return changed;
+}
 
-    static int16_t _flow = planner.flow_percentage[EXT];
-    if (_flow != planner.flow_percentage[EXT]) {
-      _flow = planner.flow_percentage[EXT];
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 116 + 2 * DASH_CHR_W, 417, _flow);
-    }
-  #endif
+void updateVariable() {
+  TERN_(DEBUG_DWIN,DWINUI::drawInt(COLOR_LIGHT_RED, COLOR_BG_BLACK, 2, DWIN_WIDTH-6*DWINUI::fontWidth(), 6, checkkey));
+  TERN_(DEBUG_DWIN,DWINUI::drawInt(COLOR_YELLOW, COLOR_BG_BLACK, 2, DWIN_WIDTH-3*DWINUI::fontWidth(), 6, last_checkkey));
 
-  #if HAS_HEATED_BED
-    if (_new_bed_temp)
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 28, 417, _bedtemp);
-    if (_new_bed_target)
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 25 + 4 * DASH_CHR_W + 6, 417, _bedtarget);
-    _drawBedIcon();
-  #endif
+  _drawXYZPosition(false);
 
-  _drawFeedrate();
+  TERN_(CV_LASER_MODULE, if (laser_device.is_laser_device()) return);
 
-  #if HAS_FAN
-    if (_new_fanspeed)
-      DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 195 + 2 * DASH_CHR_W, 384, _fanspeed);
-  #endif
+  const uint8_t changed = _setDashValues();
 
-  static float _offset = 0;
-  if (BABY_Z_VAR != _offset) {
-    _offset = BABY_Z_VAR;
-    DWINUI::drawSignedFloat(DWIN_FONT_STAT, hmiData.colorIndicator,  hmiData.colorBackground, 2, 2, 204, 417, _offset);
+  if (isMenu(tuneMenu) || isMenu(temperatureMenu)) {
+    // Tune page temperature update
+    TERN_(HAS_HOTEND, if (changed & DASH_NEW_HOTEND_TARGET) redrawItem(hotendTargetItem));
+    TERN_(HAS_HEATED_BED, if (changed & DASH_NEW_BED_TARGET) redrawItem(bedTargetItem));
+    TERN_(HAS_FAN, if (changed & DASH_NEW_FAN_SPEED) redrawItem(fanSpeedItem));
   }
+  UNUSED(changed);
+
+  // Bottom values are drawn by drawDashWidgets(), a few per update
+
+  TERN_(HAS_HOTEND, _drawHotendIcon());
+  TERN_(HAS_HEATED_BED, _drawBedIcon());
 
   #if HAS_PROUI_RUNOUT_SENSOR
     _drawRunoutIcon();
@@ -735,6 +754,17 @@ void onClickSDItem() {
   }
 }
 
+#if ENABLED(MEDIA_FILE_INDEX)
+  // Show the indexed print time and height of the selected file on the status line
+  void drawFileInfo() {
+    fileprop_t prop;
+    if (card.flag.filenameIsDir || !FileIndex::load(card.filename, prop) || !prop.time) return dwinResetStatusLine();
+    char str[22];
+    duration_t(prop.time).toString(str);
+    ui.set_status(TS(str, F("  Z"), p_float_t(prop.height(), 1), F("mm")));
+  }
+#endif
+
 #if ENABLED(SCROLL_LONG_FILENAMES)
   char shift_name[LONG_FILENAME_LENGTH + 1] = "";
 
@@ -770,6 +800,7 @@ void onClickSDItem() {
         makeNameWithoutExt(shift_name, card.longest_filename(), LONG_FILENAME_LENGTH);
         shift_len = strlen(shift_name);
         shift_amt = 0;
+        TERN_(MEDIA_FILE_INDEX, drawFileInfo());
       }
     }
     else if ((selected >= 1 + hasUpDir) && (shift_len > MENU_CHAR_LIMIT)) {
@@ -800,6 +831,7 @@ void onDrawFileName(int8_t pos, int8_t line) {
 
 void drawFileMenu() {
   if (notCurrentMenu(fileMenu)) {
+    TERN_(MEDIA_FILE_INDEX, FileIndex::reset());
     BACK_ITEM(gotoMainMenu);
     if (card.isMounted())
       for (uint8_t i = 0; i < nr_sd_menu_items(); ++i) menuItemAdd(onDrawFileName, onClickSDItem);
@@ -820,6 +852,9 @@ void hmiSDCardUpdate() {
   if (checkkey == ID_Homing) return;
   if (DWIN_lcd_sd_status != card.isMounted()) {
     DWIN_lcd_sd_status = card.isMounted();
+    #if HAS_GCODE_PREVIEW && defined(PREVIEW_THUMB_CACHE)
+      Thumbnail::invalidate();
+    #endif
     resetMenu(fileMenu);
     if (isMenu(fileMenu)) {
       currentMenu = nullptr;
@@ -835,6 +870,8 @@ void hmiSDCardUpdate() {
 
 void dwinDrawDashboard() {
 
+  dashVisible = true;
+
   dwinDrawRectangle(1, hmiData.colorBackground, 0, STATUS_Y + 21, DWIN_WIDTH, DWIN_HEIGHT - 1);
 
   dwinDrawRectangle(1, hmiData.colorSplitLine, 0, 449, DWIN_WIDTH, 451);
@@ -848,35 +885,27 @@ void dwinDrawDashboard() {
 
   #if HAS_HOTEND
     DWINUI::drawIcon(ICON_HotendTemp, DASH_ICO_COL1, 383);
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 28, 384, thermalManager.wholeDegHotend(EXT));
     DWINUI::drawString(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 25 + 3 * DASH_CHR_W + 5, 384, F("/"));
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 25 + 4 * DASH_CHR_W + 6, 384, thermalManager.degTargetHotend(EXT));
-
     DWINUI::drawIcon(ICON_StepE, 112, 417);
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 116 + 2 * DASH_CHR_W, 417, planner.flow_percentage[EXT]);
     DWINUI::drawString(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 116 + 5 * DASH_CHR_W + 2, 417, F("%"));
   #endif
 
   #if HAS_HEATED_BED
     DWINUI::drawIcon(ICON_BedTemp, DASH_ICO_COL1, 416);
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 28, 417, thermalManager.wholeDegBed());
     DWINUI::drawString(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 25 + 3 * DASH_CHR_W + 5, 417, F("/"));
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 25 + 4 * DASH_CHR_W + 6, 417, thermalManager.degTargetBed());
   #endif
 
   DWINUI::drawIcon(ICON_Speed, 113, 383);
-  DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 116 + 2 * DASH_CHR_W, 384, feedrate_percentage);
   IF_DISABLED(SHOW_SPEED_IND, DWINUI::drawString(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 116 + 5 * DASH_CHR_W + 2, 384, F("%")));
 
-  #if HAS_FAN
-    DWINUI::drawIcon(ICON_FanSpeed, 186, 383);
-    DWINUI::drawInt(DWIN_FONT_STAT, hmiData.colorIndicator, hmiData.colorBackground, 3, 195 + 2 * DASH_CHR_W, 384, thermalManager.fan_speed[FAN]);
-  #endif
+  TERN_(HAS_FAN, DWINUI::drawIcon(ICON_FanSpeed, 186, 383));
 
-  #if HAS_ZOFFSET_ITEM
-    DWINUI::drawIcon(planner.leveling_active ? ICON_SetZOffset : ICON_Zoffset, 186, 416);
-    DWINUI::drawSignedFloat(DWIN_FONT_STAT, hmiData.colorIndicator,  hmiData.colorBackground, 2, 2, 204, 417, BABY_Z_VAR);
-  #endif
+  TERN_(HAS_ZOFFSET_ITEM, DWINUI::drawIcon(planner.leveling_active ? ICON_SetZOffset : ICON_Zoffset, 186, 416));
+
+  // Draw all values now, in full
+  _setDashValues();
+  DWINUI::invalidateWidgets(dashValues, COUNT(dashValues));
+  drawDashWidgets();
 
 }
 
@@ -1012,19 +1041,22 @@ void hmiWaitForUser() {
 }
 
 #if DISABLED(PROUI_EX)
-  // Draws boot screen
+  // Draws boot screen. With PROUI_EX the library draws its own.
   void hmiInit() {
     #ifndef BOOTSCREEN_TIMEOUT
       #define BOOTSCREEN_TIMEOUT 1100
     #endif
     DWINUI::drawBox(1, COLOR_BLACK, { 5, 220, DWIN_WIDTH - 5, DWINUI::fontHeight() });
     DWINUI::drawCenteredString(COLOR_WHITE, 220, F("Professional Firmware "));
-    for (uint16_t t = 15; t <= 257; t += 11) {
-      DWINUI::drawIcon(ICON_Bar, 15, 260);
-      dwinDrawRectangle(1, hmiData.colorBackground, t, 260, 257, 280);
-      dwinUpdateLCD();
-      safe_delay((BOOTSCREEN_TIMEOUT) / 22);
-    }
+    #if DISABLED(FAST_BOOT) // Skip the timed progress bar
+      for (uint16_t t = 15; t <= 257; t += 11) {
+        DWINUI::drawIcon(ICON_Bar, 15, 260);
+        dwinDrawRectangle(1, hmiData.colorBackground, t, 260, 257, 280);
+        dwinUpdateLCD();
+        dwinTxFlush();
+        safe_delay((BOOTSCREEN_TIMEOUT) / 22);
+      }
+    #endif
   }
 #endif
 
@@ -1048,6 +1080,12 @@ void eachMomentUpdate() {
     #endif
   }
 
+  drawDashWidgets(DASH_WIDGET_BUDGET);
+
+  #if ENABLED(MEDIA_FILE_INDEX)
+    if (isMenu(fileMenu)) FileIndex::update();
+  #endif
+
   #if HAS_STATUS_MESSAGE_TIMEOUT
     bool did_expire = ui.status_reset_callback && (*ui.status_reset_callback)();
     did_expire |= ui.status_message_expire_ms && ELAPSED(ms, ui.status_message_expire_ms);
@@ -1630,6 +1668,7 @@ void MarlinUI::update() {
   hmiSDCardUpdate();  // SD card update
   eachMomentUpdate(); // Status update
   dwinHandleScreen(); // Rotary encoder update
+  dwinTxService();    // Send queued display commands
 }
 
 #if HAS_LCD_BRIGHTNESS
@@ -1640,13 +1679,16 @@ void MarlinUI::kill_screen(FSTR_P const lcd_error, FSTR_P const) {
   dwinDrawPopup(ICON_BLTouch, GET_TEXT_F(MSG_PRINTER_KILLED), lcd_error);
   DWINUI::drawCenteredString(hmiData.colorPopupTxt, 270, GET_TEXT_F(MSG_TURN_OFF));
   dwinUpdateLCD();
+  dwinTxFlush();
 }
 
 void dwinRebootScreen() {
+  dashVisible = false;
   dwinFrameClear(COLOR_BG_BLACK);
   dwinJPGShowAndCache(0);
   DWINUI::drawCenteredString(COLOR_WHITE, 220, GET_TEXT_F(MSG_PLEASE_WAIT_REBOOT));
   dwinUpdateLCD();
+  dwinTxFlush();
   safe_delay(500);
 }
 
@@ -1763,6 +1805,23 @@ void dwinRedrawScreen() {
   }
 #endif
 
+#if HAS_GCODE_PREVIEW && defined(PREVIEW_THUMB_CACHE)
+  // Confirm to print, with the thumbnail in place of the icon and text
+  void previewPopup() {
+    DWINUI::clearMainArea();
+    drawPopupBkgd();
+    const uint8_t w = fileprop.thumbwidth, h = fileprop.thumbheight;
+    if (w > DWIN_WIDTH - 30 || h > 210 || !Thumbnail::show((DWIN_WIDTH - w) / 2, 65 + (210 - h) / 2))
+      return dwinPopupConfirmCancel(ICON_Info_0, GET_TEXT_F(MSG_START_PRINT));
+    DWINUI::drawButton(BTN_Confirm, 26, 280);
+    DWINUI::drawButton(BTN_Cancel, 146, 280);
+    drawSelectHighlight(hmiFlag.select_flag);
+    dwinResetStatusLine();
+    ui.set_status_P(card.longest_filename(), true);
+    dwinUpdateLCD();
+  }
+#endif
+
 #if ENABLED(ONE_CLICK_PRINT)
   void confirmToPrintPopup() {
     dwinPopupConfirmCancel(ICON_Info_0, GET_TEXT_F(MSG_START_PRINT));
@@ -1773,11 +1832,13 @@ void dwinRedrawScreen() {
 
 void gotoConfirmToPrint() {
   #if PROUI_EX
-    fileprop.clear();
-    fileprop.setname(card.filename);
-    card.openFileRead(fileprop.name, 100);
-    getFileHeader();
-    card.closefile();
+    if (!TERN0(MEDIA_FILE_INDEX, FileIndex::load(card.filename))) {
+      fileprop.clear();
+      fileprop.setname(card.filename);
+      card.openFileRead(fileprop.name, 100);
+      getFileHeader();
+      card.closefile();
+    }
     if (fileprop.isConfig) return card.openAndPrintFile(card.filename);
   #endif
   #if ENABLED(CV_LASER_MODULE)
@@ -1787,7 +1848,11 @@ void gotoConfirmToPrint() {
       laserOn(false); // If it is not laser file turn off laser mode
   #endif
   #if HAS_GCODE_PREVIEW
-    if (TERN1(PREVIEW_MENU_ITEM, hmiData.enablePreview)) return gotoPopup(gPreview.draw, onClickConfirmToPrint);
+    #ifdef PREVIEW_THUMB_CACHE
+      if (TERN1(PREVIEW_MENU_ITEM, hmiData.enablePreview)) return gotoPopup(previewPopup, onClickConfirmToPrint);
+    #else
+      if (TERN1(PREVIEW_MENU_ITEM, hmiData.enablePreview)) return gotoPopup(gPreview.draw, onClickConfirmToPrint);
+    #endif
   #endif
   #if ENABLED(ONE_CLICK_PRINT)
     return gotoPopup(confirmToPrintPopup, onClickConfirmToPrint);
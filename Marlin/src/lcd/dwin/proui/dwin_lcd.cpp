@@ -102,6 +102,8 @@ void dwinWriteToMem(uint8_t mem, uint16_t addr, uint16_t length, uint8_t *data)
   uint16_t indx;
   uint8_t block = 0;
 
+  dwinTxFlush(); // Keep queued commands in order
+
   while (pending > 0) {
     indx = block * max_size;
     to_send = _MIN(pending, max_size);
@@ -349,4 +349,64 @@ void Title::draw(const char * const caption) {
   #endif
 }
 
+/* Widget Class =============================================================*/
+
+bool DWINUI::Widget::set(const char * const str) {
+  if (strncmp(text, str, TEXT_SIZE - 1) == 0) return false;
+  strlcpy(text, str, TEXT_SIZE);
+  dirty = true;
+  return true;
+}
+
+bool DWINUI::Widget::set(FSTR_P const fstr) {
+  char str[TEXT_SIZE];
+  strlcpy_P(str, FTOP(fstr), TEXT_SIZE);
+  return set(str);
+}
+
+// Format like DWINUI::drawInt
+bool DWINUI::Widget::setInt(const uint8_t iNum, const long value, const bool signedMode/*=false*/) {
+  char nstr[TEXT_SIZE];
+  snprintf_P(nstr, TEXT_SIZE, PSTR("%*li"), (signedMode ? iNum + 1 : iNum), value);
+  return set(nstr);
+}
+
+// Format like DWINUI::drawFloat
+bool DWINUI::Widget::setFloat(const uint8_t iNum, const uint8_t fNum, const float value, const bool signedMode/*=false*/) {
+  if (fNum == 0) return setInt(iNum, value, signedMode);
+  char nstr[20];
+  dtostrf(value, iNum + (signedMode ? 2 : 1) + fNum, fNum, nstr);
+  return set(nstr);
+}
+
+// Send only the run of characters that differs from the text on the display
+void DWINUI::Widget::draw(const uint16_t color, const uint16_t bColor) {
+  if (!dirty) return;
+  dirty = false;
+  const uint8_t len = strlen(text);
+  uint8_t first = 0, last = len;
+  if (len == strlen(shown)) {
+    while (first < len && text[first] == shown[first]) ++first;
+    if (first == len) return;
+    while (text[last - 1] == shown[last - 1]) --last;
+  }
+  else if (len < strlen(shown)) {
+    // Clear characters left over from a longer text
+    const uint8_t w = DWINUI::fontWidth(fid);
+    dwinDrawBox(1, bColor, x + len * w, y, (strlen(shown) - len) * w, DWINUI::fontHeight(fid));
+  }
+  if (last > first) dwinDrawString(true, fid, color, bColor, x + first * DWINUI::fontWidth(fid), y, &text[first], last - first);
+  strcpy(shown, text);
+}
+
+uint8_t DWINUI::drawWidgets(Widget * const list[], const uint8_t count, const uint16_t color, const uint16_t bColor, uint8_t budget/*=UINT8_MAX*/) {
+  for (uint8_t i = 0; i < count && budget; ++i)
+    if (list[i]->isDirty()) { list[i]->draw(color, bColor); --budget; }
+  return budget;
+}
+
+void DWINUI::invalidateWidgets(Widget * const list[], const uint8_t count) {
+  for (uint8_t i = 0; i < count; ++i) list[i]->invalidate();
+}
+
 #endif // DWIN_LCD_PROUI
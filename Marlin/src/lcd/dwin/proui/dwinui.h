@@ -233,6 +233,30 @@ public:
 extern Title title;
 
 namespace DWINUI {
+
+  /**
+   * Retained text field for values that change while printing.
+   * The text last sent to the display is kept, so a redraw only sends the run of
+   * characters that differs. Setting an unchanged value costs nothing.
+   */
+  class Widget {
+  public:
+    static constexpr uint8_t TEXT_SIZE = 12;
+    const uint16_t x, y;
+    const fontid_t fid;
+    Widget(const uint16_t x, const uint16_t y, const fontid_t fid) : x(x), y(y), fid(fid) { text[0] = shown[0] = '\0'; }
+    bool set(const char * const str); // Return true if the text changed
+    bool set(FSTR_P const fstr);
+    bool setInt(const uint8_t iNum, const long value, const bool signedMode=false);
+    bool setFloat(const uint8_t iNum, const uint8_t fNum, const float value, const bool signedMode=false);
+    void invalidate() { shown[0] = '\0'; dirty = true; } // Redraw all characters, e.g. after the area is cleared
+    bool isDirty() const { return dirty; }
+    void draw(const uint16_t color, const uint16_t bColor);
+  private:
+    char text[TEXT_SIZE], shown[TEXT_SIZE];
+    bool dirty = false;
+  };
+
   extern xy_int_t cursor;
   extern uint16_t penColor;
   extern uint16_t textColor;
@@ -246,6 +270,13 @@ namespace DWINUI {
   // Set text/number font
   void setFont(fontid_t cfont);
 
+  // Redraw up to 'budget' dirty widgets from a list
+  //  Return the unused budget
+  uint8_t drawWidgets(Widget * const list[], const uint8_t count, const uint16_t color, const uint16_t bColor, uint8_t budget=UINT8_MAX);
+
+  // Mark every widget in a list for a full redraw
+  void invalidateWidgets(Widget * const list[], const uint8_t count);
+
   // Get font character width
   uint8_t fontWidth(fontid_t cfont);
   inline uint8_t fontWidth() { return fontWidth(fontID); };
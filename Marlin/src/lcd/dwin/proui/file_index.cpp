@@ -0,0 +1,167 @@
+/**
+ * DWIN G-code file header index
+ * Version: 1.0.0
+ * Date: 2026/10/19
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ALL(DWIN_LCD_PROUI, HAS_MEDIA, MEDIA_FILE_INDEX)
+
+#include "file_index.h"
+
+#define INDEX_NAME  "FILEINFO.DAT"
+#define INDEX_MAGIC 0x31584946UL    // "FIX1"
+
+// One entry of the index file, after the magic number
+typedef struct {
+  uint8_t name[11];                 // 8.3 name as in the directory entry
+  uint8_t flags;                    // Bit 0: isConfig, Bit 1: isLaser
+  uint32_t size;                    // File size, modification date and time,
+  uint16_t wdate, wtime;            //  to tell when the entry is out of date
+  uint32_t thumbstart;
+  uint16_t thumbsize;
+  uint8_t thumbheight, thumbwidth;
+  float time, filament, layer,
+        minx, maxx, miny, maxy, minz, maxz;
+} index_entry_t;
+
+static_assert(sizeof(index_entry_t) == 64, "index_entry_t must be 64 bytes.");
+
+static uint32_t dirpos;             // Position in the working directory of the next entry to check
+static bool done;                   // The whole directory is indexed, or the index can't be written
+
+void FileIndex::reset() { dirpos = 0; done = false; }
+
+static bool isCurrent(const index_entry_t &e, const dir_t &p) {
+  return e.size == p.fileSize && e.wdate == p.lastWriteDate && e.wtime == p.lastWriteTime;
+}
+
+// Find the entry with the name of p. Set pos to its position, or to the end of the index if there's none.
+static bool find(MediaFile &index, const dir_t &p, index_entry_t &e, uint32_t &pos) {
+  pos = sizeof(uint32_t);
+  index.seekSet(pos);
+  for (; index.read(&e, sizeof(e)) == sizeof(e); pos += sizeof(e))
+    if (!memcmp(e.name, p.name, sizeof(e.name))) return true;
+  return false;
+}
+
+bool FileIndex::open(MediaFile &index, MediaFile dir) {
+  uint32_t magic = 0;
+  return index.open(&dir, INDEX_NAME, O_READ) && index.read(&magic, sizeof(magic)) == sizeof(magic) && magic == INDEX_MAGIC;
+}
+
+void FileIndex::update() {
+  if (done || !card.isMounted() || card.isFileOpen() || marlin.printingIsActive()) return;
+
+  MediaFile dir = card.getWorkDir();
+  dir_t p;
+  if (!dir.seekSet(dirpos) || dir.readDir(&p, nullptr) <= 0) { done = true; return; }
+  dirpos = dir.curPosition();
+
+  // Only the G-code files the browser lists
+  if (DIR_IS_SUBDIR(&p) || (p.attributes & DIR_ATT_HIDDEN) || p.name[8] != 'G' || p.name[9] == '~') return;
+
+  index_entry_t e;
+  uint32_t pos = 0;
+  {
+    MediaFile index;
+    if (open(index, dir) && find(index, p, e, pos) && isCurrent(e, p)) return;
+  }
+
+  // Read the header with the same code as the confirm screen, keeping the fileprop in use
+  char name[FILENAME_LENGTH];
+  MediaFile::dirName(p, name);
+  const fileprop_t saved = fileprop;
+  fileprop.clear();
+  fileprop.setname(name);
+  card.openFileRead(name, 100);
+  if (card.isFileOpen()) {
+    getFileHeader();
+    card.closefile();
+  }
+
+  memcpy(e.name, p.name, sizeof(e.name));
+  e.flags = fileprop.isConfig | (fileprop.isLaser << 1);
+  e.size = p.fileSize;
+  e.wdate = p.lastWriteDate;
+  e.wtime = p.lastWriteTime;
+  e.thumbstart = fileprop.thumbstart;
+  e.thumbsize = fileprop.thumbsize;
+  e.thumbheight = fileprop.thumbheight;
+  e.thumbwidth = fileprop.thumbwidth;
+  e.time = fileprop.time;
+  e.filament = fileprop.filament;
+  e.layer = fileprop.layer;
+  e.minx = fileprop.minx; e.maxx = fileprop.maxx;
+  e.miny = fileprop.miny; e.maxy = fileprop.maxy;
+  e.minz = fileprop.minz; e.maxz = fileprop.maxz;
+  fileprop = saved;
+
+  // Rewrite the old entry or append a new one. Start a new index if there's no valid one.
+  MediaFile index;
+  if (!index.open(&dir, INDEX_NAME, pos ? O_RDWR : O_RDWR | O_CREAT | O_TRUNC)) { done = true; return; }
+  if (pos)
+    index.seekSet(pos);
+  else {
+    const uint32_t magic = INDEX_MAGIC;
+    index.write(&magic, sizeof(magic));
+  }
+  if (index.write(&e, sizeof(e)) != sizeof(e)) done = true;
+}
+
+bool FileIndex::load(const char * const name, fileprop_t &prop/*=fileprop*/) {
+  MediaFile dir = card.getWorkDir();
+  dir_t p;
+  {
+    MediaFile file;
+    if (!file.open(&dir, name, O_READ) || !file.dirEntry(&p)) return false;
+  }
+
+  MediaFile index;
+  index_entry_t e;
+  uint32_t pos;
+  if (!open(index, dir) || !find(index, p, e, pos) || !isCurrent(e, p)) return false;
+
+  prop.clear();
+  prop.setname(name);
+  prop.isConfig = TEST(e.flags, 0);
+  prop.isLaser = TEST(e.flags, 1);
+  prop.thumbstart = e.thumbstart;
+  prop.thumbsize = e.thumbsize;
+  prop.thumbheight = e.thumbheight;
+  prop.thumbwidth = e.thumbwidth;
+  prop.time = e.time;
+  prop.filament = e.filament;
+  prop.layer = e.layer;
+  prop.minx = e.minx; prop.maxx = e.maxx;
+  prop.miny = e.miny; prop.maxy = e.maxy;
+  prop.minz = e.minz; prop.maxz = e.maxz;
+  return true;
+}
+
+void FileIndex::report(MediaFile &index, const dir_t &p) {
+  index_entry_t e;
+  uint32_t pos;
+  if (!index.isOpen() || !find(index, p, e, pos) || !isCurrent(e, p)) return;
+  SERIAL_ECHO(
+    F(" TIME:"), lroundf(e.time), F(" FIL:"), p_float_t(e.filament, 2),
+    F(" DIM:"), p_float_t(e.maxx - e.minx, 1), C('x'), p_float_t(e.maxy - e.miny, 1), C('x'), p_float_t(e.maxz - e.minz + e.layer, 1)
+  );
+}
+
+#endif // DWIN_LCD_PROUI && HAS_MEDIA && MEDIA_FILE_INDEX
@@ -0,0 +1,47 @@
+/**
+ * DWIN G-code file header index
+ * Version: 1.0.0
+ * Date: 2026/10/19
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * While the media browser is shown, the G-code files of the working directory
+ * get their headers read, one file per idle slice, and the results are kept in
+ * the directory's FILEINFO.DAT. Entries are keyed by the 8.3 name, size, and
+ * modification time, so a changed file is indexed again and its entry rewritten.
+ *
+ * The confirm screen, the browser, and M20 I take the print time, filament, and
+ * dimensions from the index instead of reopening and scanning each file.
+ */
+
+#include "../../../sd/cardreader.h"
+#include "../../../prouiex/file_header.h"
+
+class FileIndex {
+  public:
+    // Start over with the working directory, e.g., after a directory or media change
+    static void reset();
+    // Index the next file of the working directory, if needed
+    static void update();
+    // Fill prop with the indexed header of a file in the working directory. False if it isn't indexed.
+    static bool load(const char * const name, fileprop_t &prop=fileprop);
+    // Open the index of a directory for reading. False if there's no valid index.
+    static bool open(MediaFile &index, MediaFile dir);
+    // Print the indexed header of a directory entry for M20 I. Nothing if it isn't indexed.
+    static void report(MediaFile &index, const dir_t &p);
+};
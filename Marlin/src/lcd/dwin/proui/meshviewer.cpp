@@ -93,7 +93,10 @@ void MeshViewer::drawPoint(const uint8_t x, const uint8_t y, const float z) {
     dwinDrawString(false, meshfont, DWINUI::textColor, DWINUI::backColor, px(x) - 2 * fs, py(y) - fs, str_1);
   }
   SERIAL_FLUSH();
-  TERN_(TJC_DISPLAY, delay(100));
+  #if ENABLED(TJC_DISPLAY)
+    dwinTxFlush();
+    delay(100);
+  #endif
 }
 
 void MeshViewer::drawMesh(const bed_mesh_t zval, const uint8_t csizex, const uint8_t csizey) {
@@ -25,6 +25,9 @@
 
 #if HAS_GCODE_PREVIEW
   #include "gcode_preview.h"
+  #ifdef PREVIEW_THUMB_CACHE
+    #include "thumbnail.h"
+  #endif
 #endif
 
 #include "../../marlinui.h"
@@ -89,18 +92,30 @@ void popupPauseOrStop() {
   dwinPopupConfirmCancel(ICON_BLTouch, select_print.now == PRINT_PAUSE_RESUME ? GET_TEXT_F(MSG_PAUSE_PRINT) : GET_TEXT_F(MSG_STOP_PRINT));
 }
 
+// Progress fields, redrawn only where the text changes
+DWINUI::Widget printPercent(117, 133, font8x16), printElapsed(47, 192, font8x16);
+#if ENABLED(SHOW_REMAINING_TIME)
+  DWINUI::Widget printRemain(181, 192, font8x16);
+#endif
+
 void drawPrintLabels() {
   DWINUI::drawIcon(ICON_PrintTime, 15, 173);
   DWINUI::drawString( 46, 173, GET_TEXT_F(MSG_INFO_PRINT_TIME));
   DWINUI::drawIcon(ICON_RemainTime, 150, 171);
   DWINUI::drawString(181, 173, GET_TEXT_F(MSG_REMAINING_TIME));
+  DWINUI::drawString(hmiData.colorPercentTxt, 142, 133, F("%"));
+  // The main area was cleared
+  printPercent.invalidate();
+  printElapsed.invalidate();
+  TERN_(SHOW_REMAINING_TIME, printRemain.invalidate());
 }
 
 void drawPrintProgressElapsed() {
   MString<12> buf;
   const duration_t elapsed = print_job_timer.duration(); // Print timer
   buf.setf(F("%02i:%02i "), uint16_t(elapsed.value / 3600), (uint16_t(elapsed.value) % 3600) / 60);
-  DWINUI::drawString(hmiData.colorText, hmiData.colorBackground, 47, 192, buf);
+  printElapsed.set(buf);
+  printElapsed.draw(hmiData.colorText, hmiData.colorBackground);
 }
 
 #if ENABLED(SHOW_REMAINING_TIME)
@@ -108,7 +123,8 @@ void drawPrintProgressElapsed() {
     const uint32_t _remain_time = ui.get_remaining_time();
     MString<12> buf;
     buf.setf(F("%02i:%02i "), _remain_time / 3600, (_remain_time % 3600) / 60);
-    DWINUI::drawString(hmiData.colorText, hmiData.colorBackground, 181, 192, buf);
+    printRemain.set(buf);
+    printRemain.draw(hmiData.colorText, hmiData.colorBackground);
   }
 #endif
 
@@ -116,8 +132,8 @@ void drawPrintProgressBar() {
   const uint8_t _percent_done = ui.get_progress_percent();
   DWINUI::drawIconWB(ICON_Bar, 15, 93);
   dwinDrawRectangle(1, hmiData.colorBarfill, 16 + (_percent_done * 240) / 100, 93, 256, 113);
-  DWINUI::drawInt(hmiData.colorPercentTxt, hmiData.colorBackground, 3, 117, 133, _percent_done);
-  DWINUI::drawString(hmiData.colorPercentTxt, 142, 133, F("%"));
+  printPercent.setInt(3, _percent_done);
+  printPercent.draw(hmiData.colorPercentTxt, hmiData.colorBackground);
 }
 
 void iconResumeOrPause() {
@@ -161,23 +177,9 @@ void Printing::printUpdate(bool force) {
     drawPrintProgressBar();
   }
 
-  // Remaining time
-  #if ENABLED(SHOW_REMAINING_TIME)
-    static uint32_t _remain_time = 0;
-    const uint32_t rt = ui.get_remaining_time();
-    if (force || (_remain_time != rt)) {
-      _remain_time = rt;
-      drawPrintProgressRemain();
-    }
-  #endif
-
-  // Elapse print time
-  static uint16_t _printtime = 0;
-  const uint16_t min = (print_job_timer.duration() % 3600) / 60;
-  if (force || (_printtime != min)) { // 1 minute update
-    _printtime = min;
-    drawPrintProgressElapsed();
-  }
+  // Remaining and elapsed print time. Only changed characters are sent.
+  TERN_(SHOW_REMAINING_TIME, drawPrintProgressRemain());
+  drawPrintProgressElapsed();
 }
 
 void Printing::drawPrintProcess() {
@@ -202,6 +204,9 @@ void Printing::drawPrintDone() {
   #if HAS_GCODE_PREVIEW
     const bool haspreview = gPreview.isValid();
     if (haspreview) {
+      #ifdef PREVIEW_THUMB_CACHE
+        Thumbnail::invalidate();  // GPreview uses the display SRAM too
+      #endif
       gPreview.show();
       DWINUI::drawButton(BTN_Continue, 86, 295);
     }
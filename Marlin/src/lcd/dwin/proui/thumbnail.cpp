@@ -0,0 +1,146 @@
+/**
+ * DWIN G-code thumbnail streaming and cache
+ * Version: 1.0.0
+ * Date: 2026/10/19
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+#if ALL(DWIN_LCD_PROUI, HAS_GCODE_PREVIEW) && defined(PREVIEW_THUMB_CACHE)
+
+#include "../../../sd/cardreader.h"
+#include "../../../prouiex/file_header.h"
+#include "dwin_lcd.h"
+#include "dwinui.h"
+#include "thumbnail.h"
+
+#define THUMB_SRAM_SIZE 0x8000U
+#define THUMB_SLOT_SIZE (THUMB_SRAM_SIZE / (PREVIEW_THUMB_CACHE))
+
+static_assert(WITHIN(PREVIEW_THUMB_CACHE, 1, 8), "PREVIEW_THUMB_CACHE must be from 1 to 8.");
+
+static struct {
+  uint32_t signature;   // Signature of the cached thumbnail. 0 if the slot is empty.
+  uint8_t used;         // Stamp of the last use, for LRU replacement
+} slots[PREVIEW_THUMB_CACHE];
+static uint8_t stamp;
+
+void Thumbnail::invalidate() {
+  for (auto &s : slots) s.signature = 0;
+}
+
+// FNV-1a of the header fields that identify a file's thumbnail
+static uint32_t signature() {
+  uint32_t h = 2166136261UL;
+  auto add = [&h](const void * const data, const uint8_t len) {
+    const uint8_t *b = (const uint8_t *)data;
+    for (uint8_t i = 0; i < len; ++i) h = (h ^ b[i]) * 16777619UL;
+  };
+  add(fileprop.name, strlen(fileprop.name));
+  add(&fileprop.thumbstart, sizeof(fileprop.thumbstart));
+  add(&fileprop.thumbsize, sizeof(fileprop.thumbsize));
+  add(&fileprop.time, sizeof(fileprop.time));
+  add(&fileprop.filament, sizeof(fileprop.filament));
+  return h ?: 1;
+}
+
+static int8_t base64Value(const char c) {
+  if (WITHIN(c, 'A', 'Z')) return c - 'A';
+  if (WITHIN(c, 'a', 'z')) return c - 'a' + 26;
+  if (WITHIN(c, '0', '9')) return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;                                      // '=' padding
+}
+
+/**
+ * Decode the base64 thumbnail of the open file as it is read, and write the
+ * JPEG to the display SRAM one chunk at a time. Return the JPEG size, 0 on error.
+ * Only thumbsize characters are read, not counting "; " prefixes and line ends.
+ */
+static uint16_t streamToSRAM(const uint16_t addr) {
+  card.setIndex(fileprop.thumbstart);
+  uint8_t in[64], out[96];
+  uint16_t left = fileprop.thumbsize, sram = addr, bitbuf = 0;
+  uint8_t outlen = 0, bits = 0;
+  while (left) {
+    const int16_t n = card.read(in, sizeof(in));
+    if (n <= 0) return 0;
+    for (int16_t i = 0; i < n && left; ++i) {
+      const char c = in[i];
+      if (ISEOL(c) || c == ';' || c == ' ') continue;
+      --left;
+      const int8_t v = base64Value(c);
+      if (v < 0) continue;
+      bitbuf = (bitbuf << 6) | v;
+      bits += 6;
+      if (bits >= 8) {
+        bits -= 8;
+        out[outlen++] = uint8_t(bitbuf >> bits);
+        if (outlen == sizeof(out)) {
+          DWINUI::writeToSRAM(sram, outlen, out);
+          sram += outlen;
+          outlen = 0;
+        }
+      }
+    }
+  }
+  if (outlen) {
+    DWINUI::writeToSRAM(sram, outlen, out);
+    sram += outlen;
+  }
+  return sram - addr;
+}
+
+bool Thumbnail::show(const uint16_t x, const uint16_t y) {
+  if (!fileprop.thumbsize) return false;
+
+  // The JPEG is at most 3/4 the size of its base64 text
+  const uint32_t jpgmax = uint32_t(fileprop.thumbsize) * 3 / 4;
+  if (jpgmax > THUMB_SRAM_SIZE) return false;
+
+  const uint32_t sig = signature();
+  uint8_t s = 0;
+  for (uint8_t i = 0; i < PREVIEW_THUMB_CACHE; ++i) {
+    if (slots[i].signature == sig) {
+      slots[i].used = ++stamp;
+      dwinIconShow(x, y, i * THUMB_SLOT_SIZE);
+      return true;
+    }
+    if (slots[s].signature && (!slots[i].signature || uint8_t(stamp - slots[i].used) > uint8_t(stamp - slots[s].used))) s = i;
+  }
+
+  // Too big for a slot? Use the whole SRAM.
+  const bool fits = jpgmax <= THUMB_SLOT_SIZE;
+  if (!fits) { invalidate(); s = 0; }
+  slots[s].signature = 0;
+
+  card.openFileRead(fileprop.name, 100);
+  if (!card.isFileOpen()) return false;
+  const uint16_t addr = s * THUMB_SLOT_SIZE, size = streamToSRAM(addr);
+  card.closefile();
+  if (!size) return false;
+
+  if (fits) {
+    slots[s].signature = sig;
+    slots[s].used = ++stamp;
+  }
+  dwinIconShow(x, y, addr);
+  return true;
+}
+
+#endif // DWIN_LCD_PROUI && HAS_GCODE_PREVIEW && PREVIEW_THUMB_CACHE
@@ -0,0 +1,41 @@
+/**
+ * DWIN G-code thumbnail streaming and cache
+ * Version: 1.0.0
+ * Date: 2026/10/19
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * The slicer scripts embed a JPEG thumbnail as base64 comment lines. The
+ * thumbnail is decoded while it's read from the media and each decoded chunk
+ * goes straight to the display SRAM, where the display decodes the JPEG.
+ *
+ * The SRAM is split into PREVIEW_THUMB_CACHE slots. Each slot keeps the JPEG
+ * of one file, keyed by a signature of the file name, size and thumbnail
+ * position, so showing the same file again doesn't read the media at all.
+ * A thumbnail too big for a slot uses the whole SRAM and clears the cache.
+ */
+
+#include <stdint.h>
+
+class Thumbnail {
+  public:
+    // Draw the thumbnail described by fileprop with its upper-left at x, y. False if there's none.
+    static bool show(const uint16_t x, const uint16_t y);
+    // Forget all cached thumbnails, e.g., when the media changes or the SRAM is used for something else
+    static void invalidate();
+};
@@ -43,6 +43,10 @@
   #include "../module/printcounter.h"
 #endif
 
+#if ENABLED(SD_TIME_ESTIMATE)
+  #include "../feature/time_estimate.h"
+#endif
+
 #if ENABLED(ADVANCED_PAUSE_FEATURE)
   #include "../feature/pause.h"
 #endif
@@ -332,6 +336,10 @@ public:
     #endif
     #if ANY(SHOW_REMAINING_TIME, SET_PROGRESS_MANUALLY)
       static uint32_t _calculated_remaining_time() {
+        #if ENABLED(SD_TIME_ESTIMATE)
+          const uint32_t estimate = timeEstimate.remaining(card.getIndex());
+          if (estimate) return estimate;
+        #endif
         #if ANY(REMAINING_TIME_PRIME, REMAINING_TIME_AUTOPRIME)
           return print_job_timer.remainingTimeEstimate(card.getIndex());
         #else
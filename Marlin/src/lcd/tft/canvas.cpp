@@ -31,6 +31,10 @@ uint16_t Canvas::startLine, Canvas::endLine;
 uint16_t Canvas::background_color;
 uint16_t *Canvas::buffer = TFT::buffer;
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  static_assert(CANVAS_BUFFER_WORDS >= TFT_WIDTH, "TFT_DOUBLE_BUFFER requires TFT_BUFFER_WORDS of at least 2 * TFT_WIDTH.");
+#endif
+
 void Canvas::instantiate(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
   width = w;
   height = h;
@@ -44,11 +48,15 @@ void Canvas::instantiate(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
 
 void Canvas::next() {
   startLine = endLine;
-  endLine = (TFT_BUFFER_WORDS) < width * (height - startLine) ? startLine + (TFT_BUFFER_WORDS) / width : height;
+  endLine = (CANVAS_BUFFER_WORDS) < width * (height - startLine) ? startLine + (CANVAS_BUFFER_WORDS) / width : height;
 }
 
 bool Canvas::toScreen() {
   tft.write_sequence(buffer, width * (endLine - startLine));
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // Draw the next strip in the other half while this one is sent
+    buffer = buffer == TFT::buffer ? TFT::buffer + (CANVAS_BUFFER_WORDS) : TFT::buffer;
+  #endif
   return endLine == height;
 }
 
@@ -87,16 +95,133 @@ void Canvas::addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, u
     if (stringWidth + pGlyph->bbxWidth > maxWidth) break;
     switch (getFontType()) {
       case FONT_MARLIN_GLYPHS_1BPP:
-        addImage(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE1, ((uint8_t *)pGlyph) + sizeof(glyph_t), &color);
+        addGlyph(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph, GREYSCALE1, color, &color);
         break;
       case FONT_MARLIN_GLYPHS_2BPP:
-        addImage(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE2, ((uint8_t *)pGlyph) + sizeof(glyph_t), colors);
+        addGlyph(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph, GREYSCALE2, color, colors);
         break;
     }
     stringWidth += pGlyph->dWidth;
   }
 }
 
+/**
+ * Unpack RLE glyph data. Each run starts with a count byte:
+ *   0x00-0x7F : Repeat the next byte (count + 1) times
+ *   0x80-0xFF : Copy the next ((count & 0x7F) + 1) bytes
+ */
+static void unpackGlyph(const uint8_t *rle, uint8_t *data, const uint8_t size) {
+  for (uint8_t *end = data + size; data < end;) {
+    const uint8_t count = *rle++;
+    uint8_t n = (count & 0x7F) + 1;
+    NOMORE(n, end - data);
+    if (count & 0x80) { memcpy(data, rle, n); rle += n; }
+    else memset(data, *rle++, n);
+    data += n;
+  }
+}
+
+void Canvas::addGlyph(int16_t x, int16_t y, glyph_t *glyph, colorMode_t color_mode, uint16_t color, uint16_t *colors) {
+  #ifdef TFT_GLYPH_CACHE
+    cachedGlyph_t *cached = findGlyph(glyph, color);
+    if (cached) return addPixels(x, y, glyph->bbxWidth, glyph->bbxHeight, cached->pixels);
+  #endif
+
+  uint8_t *data = (uint8_t *)glyph + sizeof(glyph_t);
+
+  // Glyph data smaller than the bitmap is RLE-compressed
+  const uint8_t bitsPerPixel = color_mode == GREYSCALE2 ? 2 : 1;
+  const uint16_t rawSize = ((glyph->bbxWidth * bitsPerPixel + 7) / 8) * glyph->bbxHeight;
+  uint8_t unpacked[255];
+  if (rawSize <= sizeof(unpacked) && glyph->dataSize < rawSize) {
+    unpackGlyph(data, unpacked, rawSize);
+    data = unpacked;
+  }
+
+  #ifdef TFT_GLYPH_CACHE
+    cached = cacheGlyph(glyph, color_mode, color, colors, data);
+    if (cached) return addPixels(x, y, glyph->bbxWidth, glyph->bbxHeight, cached->pixels);
+  #endif
+
+  addImage(x, y, glyph->bbxWidth, glyph->bbxHeight, color_mode, data, colors);
+}
+
+#ifdef TFT_GLYPH_CACHE
+
+  cachedGlyph_t Canvas::glyphCache[TFT_GLYPH_CACHE];
+  uint16_t Canvas::glyphStamp;
+
+  // Pixels of a cached glyph that aren't drawn
+  #define GLYPH_TRANSPARENT 0x0001
+
+  /**
+   * Find a glyph already drawn with this color over the current background.
+   * A font change doesn't invalidate the cache. Glyph addresses stay unique and
+   * glyphs of the old font are replaced as they age.
+   */
+  cachedGlyph_t* Canvas::findGlyph(glyph_t *glyph, uint16_t color) {
+    for (uint8_t i = 0; i < TFT_GLYPH_CACHE; i++) {
+      cachedGlyph_t &c = glyphCache[i];
+      if (c.glyph == glyph && c.color == color && c.background == background_color) {
+        c.used = ++glyphStamp;
+        return &c;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Resolve the glyph bitmap to colors in the least recently used slot.
+   * Return nullptr if the glyph is too big or one of its colors is the
+   * transparent color, so the caller draws it directly.
+   */
+  cachedGlyph_t* Canvas::cacheGlyph(glyph_t *glyph, colorMode_t color_mode, uint16_t color, uint16_t *colors, uint8_t *data) {
+    const uint8_t image_width = glyph->bbxWidth, image_height = glyph->bbxHeight;
+    if (image_width * image_height > TFT_GLYPH_CACHE_PIXELS) return nullptr;
+
+    const uint8_t bitsPerPixel = color_mode == GREYSCALE2 ? 2 : 1, levels = (1 << bitsPerPixel) - 1;
+    for (uint8_t i = 0; i < levels; i++) if (colors[i] == GLYPH_TRANSPARENT) return nullptr;
+
+    cachedGlyph_t *slot = &glyphCache[0];
+    for (uint8_t i = 1; i < TFT_GLYPH_CACHE && slot->glyph; i++) {
+      cachedGlyph_t &c = glyphCache[i];
+      if (!c.glyph || uint16_t(glyphStamp - c.used) > uint16_t(glyphStamp - slot->used)) slot = &c;
+    }
+
+    const uint8_t obase = 8 - bitsPerPixel;
+    uint16_t *pixel = slot->pixels;
+    for (uint8_t i = 0; i < image_height; i++) {
+      int8_t offset = obase;
+      for (uint8_t j = 0; j < image_width; j++) {
+        if (offset < 0) { data++; offset = obase; }
+        const uint8_t ci = (*data >> offset) & levels;
+        *pixel++ = ci ? colors[ci - 1] : GLYPH_TRANSPARENT;
+        offset -= bitsPerPixel;
+      }
+      data++;
+    }
+
+    slot->glyph = glyph;
+    slot->color = color;
+    slot->background = background_color;
+    slot->used = ++glyphStamp;
+    return slot;
+  }
+
+  // Copy resolved glyph pixels to the canvas, skipping transparent pixels
+  void Canvas::addPixels(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, uint16_t *data) {
+    uint16_t yc = y <= startLine ? 0 : (y - startLine) * width;
+    for (int16_t i = 0; i < image_height && y < endLine; i++, y++, data += image_width) {
+      if (y < startLine) continue;
+      uint16_t *pixel = buffer + x + yc;
+      yc += width;
+      for (int16_t j = 0; j < image_width; j++, pixel++)
+        if (data[j] != GLYPH_TRANSPARENT && WITHIN(x + j, 0, width - 1)) *pixel = data[j];
+    }
+  }
+
+#endif // TFT_GLYPH_CACHE
+
 void Canvas::addImage(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
   uint16_t *data = (uint16_t *)images[image].data;
   if (!data) return;
@@ -27,6 +27,27 @@
 
 #include "../../inc/MarlinConfig.h"
 
+// With TFT_DOUBLE_BUFFER each half of the TFT buffer holds one strip
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  #define CANVAS_BUFFER_WORDS ((TFT_BUFFER_WORDS) / 2)
+#else
+  #define CANVAS_BUFFER_WORDS (TFT_BUFFER_WORDS)
+#endif
+
+#ifdef TFT_GLYPH_CACHE
+  #ifndef TFT_GLYPH_CACHE_PIXELS
+    #define TFT_GLYPH_CACHE_PIXELS 288 // Largest glyph to cache, in pixels
+  #endif
+
+  // A glyph drawn in one color over one background, ready to copy
+  typedef struct {
+    const glyph_t *glyph;     // Glyphs are in flash, so the address identifies the bitmap
+    uint16_t color, background;
+    uint16_t used;            // Stamp of the last use, for LRU replacement
+    uint16_t pixels[TFT_GLYPH_CACHE_PIXELS];
+  } cachedGlyph_t;
+#endif
+
 class Canvas {
   private:
     static uint16_t background_color;
@@ -40,8 +61,17 @@ class Canvas {
     inline static uint16_t getFontHeight() { return TFT_String::font_height(); }
 
     static void addImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors);
+    static void addGlyph(int16_t x, int16_t y, glyph_t *glyph, colorMode_t color_mode, uint16_t color, uint16_t *colors);
     static void addImage(uint16_t x, uint16_t y, uint16_t imageWidth, uint16_t imageHeight, uint16_t color, uint16_t bgColor, uint8_t *image);
 
+    #ifdef TFT_GLYPH_CACHE
+      static cachedGlyph_t glyphCache[TFT_GLYPH_CACHE];
+      static uint16_t glyphStamp;
+      static cachedGlyph_t *findGlyph(glyph_t *glyph, uint16_t color);
+      static cachedGlyph_t *cacheGlyph(glyph_t *glyph, colorMode_t color_mode, uint16_t color, uint16_t *colors, uint8_t *data);
+      static void addPixels(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, uint16_t *data);
+    #endif
+
   public:
     static void instantiate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
     static void next();
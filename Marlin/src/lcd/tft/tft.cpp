@@ -35,6 +35,7 @@ uint16_t TFT::buffer[];
 void TFT::init() {
   io.init();
   io.initTFT();
+  queue.invalidate();
 }
 
 TFT tft;
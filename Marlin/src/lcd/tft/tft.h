@@ -65,8 +65,8 @@ class TFT {
     static uint16_t buffer[TFT_BUFFER_WORDS];
 
     static void init();
-    static void set_font(const uint8_t *Font) { string.set_font(Font); }
-    static void add_glyphs(const uint8_t *Font) { string.add_glyphs(Font); }
+    static void set_font(const uint8_t *Font) { string.set_font(Font); queue.invalidate(); }
+    static void add_glyphs(const uint8_t *Font) { string.add_glyphs(Font); queue.invalidate(); }
 
     static bool is_busy() { return io.isBusy(); }
     static void abort() { io.abort(); }
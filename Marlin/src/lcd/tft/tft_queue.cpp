@@ -34,6 +34,15 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
+#ifdef TFT_DIRTY_RECTS
+  drawnRect_t TFT_Queue::drawn[TFT_DIRTY_RECTS];
+  uint8_t TFT_Queue::drawn_index = 0;
+#endif
+
+#if ENABLED(TFT_QUEUE_STATS)
+  frameStats_t TFT_Queue::stats;
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
 
@@ -51,6 +60,10 @@ void TFT_Queue::async() {
   if (tft.is_busy()) return;
 
   if (task->state == TASK_STATE_COMPLETED) {
+    #ifdef TFT_DIRTY_RECTS
+      // The last strip has been sent so the canvas is on the screen
+      if (task->type == TASK_CANVAS) set_drawn((parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t)));
+    #endif
     task = (queueTask_t *)task->nextTask;
     current_task = (uint8_t *)task;
   }
@@ -58,7 +71,10 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE:
+      TERN_(TFT_QUEUE_STATS, report_frame());
+      reset();
+      break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
@@ -73,10 +89,21 @@ void TFT_Queue::finish_sketch() {
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
 
-    if (!current_task) current_task = (uint8_t *)task;
+    start_frame((uint8_t *)task);
   }
 }
 
+// Start processing tasks, unless the queue is already busy
+void TFT_Queue::start_frame(uint8_t *task) {
+  if (current_task) return;
+  current_task = task;
+  #if ENABLED(TFT_QUEUE_STATS)
+    stats.start_us = micros();
+    stats.canvases = stats.skipped = stats.strips = 0;
+    stats.pixels = 0;
+  #endif
+}
+
 void TFT_Queue::fill(queueTask_t *task) {
   uint16_t count;
   parametersFill_t *task_parameters = (parametersFill_t *)(((uint8_t *)task) + sizeof(queueTask_t));
@@ -84,6 +111,10 @@ void TFT_Queue::fill(queueTask_t *task) {
   if (task->state == TASK_STATE_READY) {
     tft.set_window(task_parameters->x, task_parameters->y, task_parameters->x + task_parameters->width - 1, task_parameters->y + task_parameters->height - 1);
     task->state = TASK_STATE_IN_PROGRESS;
+    #ifdef TFT_DIRTY_RECTS
+      invalidate(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    #endif
+    TERN_(TFT_QUEUE_STATS, stats.pixels += task_parameters->count);
   }
 
   if (task_parameters->count > DMA_MAX_WORDS) {
@@ -102,13 +133,43 @@ void TFT_Queue::fill(queueTask_t *task) {
 void TFT_Queue::canvas(queueTask_t *task) {
   parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
 
-  uint16_t i;
-  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
-
   if (task->state == TASK_STATE_READY) {
+    #ifdef TFT_DIRTY_RECTS
+      // The same canvas is still on the screen. Don't send it again.
+      if (is_drawn(task_parameters)) {
+        task->state = TASK_STATE_COMPLETED;
+        TERN_(TFT_QUEUE_STATS, stats.skipped++);
+        return;
+      }
+      invalidate(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    #endif
+    #if ENABLED(TFT_QUEUE_STATS)
+      stats.canvases++;
+      stats.pixels += uint32_t(task_parameters->width) * task_parameters->height;
+    #endif
     task->state = TASK_STATE_IN_PROGRESS;
     tftCanvas.instantiate(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    draw_strip(task_parameters);
   }
+  #if DISABLED(TFT_DOUBLE_BUFFER)
+    else
+      draw_strip(task_parameters);
+  #endif
+
+  TERN_(TFT_QUEUE_STATS, stats.strips++);
+  if (tftCanvas.toScreen())
+    task->state = TASK_STATE_COMPLETED;
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    else
+      draw_strip(task_parameters); // Draw the next strip while DMA sends this one
+  #endif
+}
+
+// Draw the canvas items that fall within the next strip into the canvas buffer
+void TFT_Queue::draw_strip(parametersCanvas_t *task_parameters) {
+  uint16_t i;
+  uint8_t *item = ((uint8_t *)task_parameters) + sizeof(parametersCanvas_t);
+
   tftCanvas.next();
 
   for (i = 0; i < task_parameters->count; i++) {
@@ -143,7 +204,6 @@ void TFT_Queue::canvas(queueTask_t *task) {
     item = ((parametersCanvasBackground_t *)item)->nextParameter;
   }
 
-  if (tftCanvas.toScreen()) task->state = TASK_STATE_COMPLETED;
 }
 
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -169,7 +229,7 @@ void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ui
   task->state = TASK_STATE_READY;
   task->type = TASK_FILL;
 
-  if (!current_task) current_task = (uint8_t *)task;
+  start_frame((uint8_t *)task);
 }
 
 void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
@@ -192,8 +252,11 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->width = width;
   task_parameters->height = height;
   task_parameters->count = 0;
+  #ifdef TFT_DIRTY_RECTS
+    task_parameters->hash = 2166136261UL; // FNV-1a offset basis
+  #endif
 
-  if (!current_task) current_task = (uint8_t *)task;
+  start_frame((uint8_t *)task);
 }
 
 void TFT_Queue::set_background(uint16_t color) {
@@ -208,6 +271,7 @@ void TFT_Queue::set_background(uint16_t color) {
   end_of_queue += sizeof(parametersCanvasBackground_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  hash_item((uint8_t *)parameters);
 }
 
 #define QUEUE_SAFETY_FREE_SPACE 100
@@ -231,6 +295,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
   parameters->x = x;
   parameters->y = y;
   parameters->color = ENDIAN_COLOR(color);
+  parameters->count = 0;
   parameters->stringLength = 0;
   parameters->maxWidth = maxWidth;
 
@@ -249,6 +314,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
 
   parameters->nextParameter = end_of_queue;
   task_parameters->count++;
+  hash_item((uint8_t *)parameters);
 }
 
 void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint16_t *string, uint16_t maxWidth) {
@@ -263,6 +329,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint16_t
   parameters->x = x;
   parameters->y = y;
   parameters->color = ENDIAN_COLOR(color);
+  parameters->count = 0;
   parameters->stringLength = 0;
   parameters->maxWidth = maxWidth;
 
@@ -276,6 +343,7 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint16_t
   parameters->nextParameter = end_of_queue;
   parameters->stringLength = pointer - string;
   task_parameters->count++;
+  hash_item((uint8_t *)parameters);
 }
 
 void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
@@ -295,7 +363,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   colorMode_t color_mode = images[image].colorMode;
 
-  if (color_mode == HIGHCOLOR) return;
+  if (color_mode == HIGHCOLOR) return hash_item((uint8_t *)parameters);
 
   uint16_t *color = (uint16_t *)end_of_queue;
   uint8_t color_count = 0;
@@ -315,6 +383,7 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
 
   end_of_queue = (uint8_t *)color;
   parameters->nextParameter = end_of_queue;
+  hash_item((uint8_t *)parameters);
 }
 
 uint16_t gradient(uint16_t colorA, uint16_t colorB, uint16_t factor) {
@@ -369,6 +438,7 @@ void TFT_Queue::add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   end_of_queue += sizeof(parametersCanvasBar_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  hash_item((uint8_t *)parameters);
 }
 
 void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -387,6 +457,67 @@ void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t h
   end_of_queue += sizeof(parametersCanvasRectangle_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+  hash_item((uint8_t *)parameters);
 }
 
+#ifdef TFT_DIRTY_RECTS
+
+  // Mix the values of a new canvas item into the canvas hash (FNV-1a)
+  void TFT_Queue::hash_item(uint8_t *item) {
+    parametersCanvas_t *task_parameters = (parametersCanvas_t *)(last_task + sizeof(queueTask_t));
+    uint32_t hash = (task_parameters->hash ^ *item) * 16777619UL;
+    // Skip the item type and the link to the next item, which depends on the queue position
+    for (uint8_t *b = item + sizeof(CanvasSubtype) + sizeof(uint8_t *); b < end_of_queue; ++b)
+      hash = (hash ^ *b) * 16777619UL;
+    task_parameters->hash = hash;
+  }
+
+  bool TFT_Queue::is_drawn(const parametersCanvas_t *p) {
+    for (uint8_t i = 0; i < TFT_DIRTY_RECTS; ++i) {
+      const drawnRect_t &r = drawn[i];
+      if (r.width && r.x == p->x && r.y == p->y && r.width == p->width && r.height == p->height && r.hash == p->hash)
+        return true;
+    }
+    return false;
+  }
+
+  // Remember a finished canvas, replacing the oldest entry when all are in use
+  void TFT_Queue::set_drawn(const parametersCanvas_t *p) {
+    invalidate(p->x, p->y, p->width, p->height);
+    uint8_t i = 0;
+    while (i < TFT_DIRTY_RECTS && drawn[i].width) ++i;
+    if (i == TFT_DIRTY_RECTS) {
+      i = drawn_index;
+      if (++drawn_index >= TFT_DIRTY_RECTS) drawn_index = 0;
+    }
+    drawn[i] = { p->x, p->y, p->width, p->height, p->hash };
+  }
+
+  // Forget the canvases that overlap an area being drawn
+  void TFT_Queue::invalidate(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height) {
+    for (uint8_t i = 0; i < TFT_DIRTY_RECTS; ++i) {
+      drawnRect_t &r = drawn[i];
+      if (r.width && x < r.x + r.width && r.x < x + width && y < r.y + r.height && r.y < y + height)
+        r.width = 0;
+    }
+  }
+
+  // Forget all canvases, when the screen is changed outside the queue
+  void TFT_Queue::invalidate() {
+    for (uint8_t i = 0; i < TFT_DIRTY_RECTS; ++i) drawn[i].width = 0;
+  }
+
+#endif // TFT_DIRTY_RECTS
+
+#if ENABLED(TFT_QUEUE_STATS)
+
+  void TFT_Queue::report_frame() {
+    SERIAL_ECHOLN(
+      F("TFT frame: "), micros() - stats.start_us, F("us canvases:"), stats.canvases,
+      F(" skipped:"), stats.skipped, F(" strips:"), stats.strips, F(" pixels:"), stats.pixels
+    );
+  }
+
+#endif
+
 #endif // HAS_GRAPHICAL_TFT
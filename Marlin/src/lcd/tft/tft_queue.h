@@ -71,6 +71,9 @@ typedef struct __attribute__((__packed__)) {
   uint16_t width;
   uint16_t height;
   uint32_t count;
+  #ifdef TFT_DIRTY_RECTS
+    uint32_t hash;
+  #endif
 } parametersCanvas_t;
 
 typedef struct __attribute__((__packed__)) {
@@ -118,6 +121,22 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#ifdef TFT_DIRTY_RECTS
+  // An area of the screen with the content of a finished canvas
+  typedef struct {
+    uint16_t x, y, width, height;
+    uint32_t hash;
+  } drawnRect_t;
+#endif
+
+#if ENABLED(TFT_QUEUE_STATS)
+  typedef struct {
+    uint32_t start_us;                        // Time the first task of the frame was queued
+    uint16_t canvases, skipped, strips;       // Canvases drawn, unchanged canvases skipped, strips sent
+    uint32_t pixels;                          // Pixels sent by canvases and fills
+  } frameStats_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -129,10 +148,33 @@ class TFT_Queue {
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
+    static void draw_strip(parametersCanvas_t *task_parameters);
     static void handle_queue_overflow(uint16_t sizeNeeded);
+    static void start_frame(uint8_t *task);
+
+    #ifdef TFT_DIRTY_RECTS
+      static drawnRect_t drawn[TFT_DIRTY_RECTS];
+      static uint8_t drawn_index;
+      static bool is_drawn(const parametersCanvas_t *p);
+      static void set_drawn(const parametersCanvas_t *p);
+      static void hash_item(uint8_t *item);
+    #else
+      static void hash_item(uint8_t*) {}
+    #endif
+
+    #if ENABLED(TFT_QUEUE_STATS)
+      static frameStats_t stats;
+      static void report_frame();
+    #endif
 
   public:
     static void reset();
+    #ifdef TFT_DIRTY_RECTS
+      static void invalidate(const uint16_t x, const uint16_t y, const uint16_t width, const uint16_t height);
+      static void invalidate();
+    #else
+      static void invalidate() {}
+    #endif
     static void async();
     static void sync() { while (current_task != nullptr) async(); }
     static bool is_empty() { return current_task == nullptr; }
@@ -63,11 +63,16 @@ typedef struct __attribute__((__packed__)) {
   int8_t   fontDescent;
 } unifont_t;
 
-// TFT glyphs
+/**
+ * TFT glyphs
+ * Glyph data is RLE-compressed when dataSize is less than the raw bitmap size
+ * (bytes per line * bbxHeight). Glyphs of more than 255 raw bytes are never compressed.
+ * See buildroot/share/scripts/rle_compress_font.py
+ */
 typedef struct __attribute__((__packed__)) {
   uint8_t bbxWidth;
   uint8_t bbxHeight;
-  uint8_t dataSize;
+  uint8_t dataSize;           // Low 8 bits of the data size
    int8_t dWidth;
    int8_t bbxOffsetX;
    int8_t bbxOffsetY;
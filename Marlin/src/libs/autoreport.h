@@ -23,7 +23,11 @@
 
 #include "../inc/MarlinConfig.h"
 
-template <typename Helper>
+/**
+ * Periodic report helper. The interval is kept in units of UNIT_MS,
+ * which is one second for the standard M154/M155-style reports.
+ */
+template <typename Helper, millis_t UNIT_MS=1000>
 struct AutoReporter {
   millis_t next_report_ms;
   uint8_t report_interval;
@@ -32,16 +36,16 @@ struct AutoReporter {
     AutoReporter() : report_port_mask(SerialMask::All) {}
   #endif
 
-  inline void set_interval(uint8_t seconds, const uint8_t limit=60) {
-    report_interval = _MIN(seconds, limit);
-    next_report_ms = millis() + SEC_TO_MS(seconds);
+  inline void set_interval(uint8_t units, const uint8_t limit=60) {
+    report_interval = _MIN(units, limit);
+    next_report_ms = millis() + units * UNIT_MS;
   }
 
   inline void tick() {
     if (!report_interval) return;
     const millis_t ms = millis();
     if (ELAPSED(ms, next_report_ms)) {
-      next_report_ms = ms + SEC_TO_MS(report_interval);
+      next_report_ms = ms + report_interval * UNIT_MS;
       PORT_REDIRECT(report_port_mask);
       Helper::report();
       PORT_RESTORE();
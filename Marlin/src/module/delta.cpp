@@ -123,6 +123,25 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+/**
+ * Delta Inverse Kinematics for a batch of segment points.
+ *
+ * Solves one tower at a time so the inner loop is the same
+ * sqrt expression over contiguous arrays, with the tower
+ * constants (and hotend offset) hoisted out of it.
+ */
+void inverse_kinematics(kinematic_batch_t &batch, const uint8_t count) {
+  float * const joint[] = { batch.a, batch.b, batch.c };
+  LOOP_ABC(t) {
+    const float tx = delta_tower[t].x + TERN0(HAS_HOTEND_OFFSET, hotend_offset[active_extruder].x),
+                ty = delta_tower[t].y + TERN0(HAS_HOTEND_OFFSET, hotend_offset[active_extruder].y),
+                rod2 = delta_diagonal_rod_2_tower[t];
+    float * const out = joint[t];
+    for (uint8_t i = 0; i < count; ++i)
+      out[i] = batch.z[i] + SQRT(rod2 - HYPOT2(tx - batch.x[i], ty - batch.y[i]));
+  }
+}
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
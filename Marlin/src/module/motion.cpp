@@ -32,6 +32,7 @@
 #include "../gcode/gcode.h"
 #include "../lcd/marlinui.h"
 #include "../inc/MarlinConfig.h"
+#include "../core/report_buffer.h"
 
 #if IS_SCARA
   #include "../libs/buzzer.h"
@@ -187,6 +188,18 @@ xyz_pos_t cartes;
                     delta_max_radius_2 = sq(float(PRINTABLE_RADIUS));
   #endif
 
+  #if DISABLED(DELTA)
+    // Other kinematics solve the batch one point at a time, in order
+    void inverse_kinematics(kinematic_batch_t &batch, const uint8_t count) {
+      xyz_pos_t raw{0};
+      for (uint8_t i = 0; i < count; ++i) {
+        raw.x = batch.x[i]; raw.y = batch.y[i]; TERN_(HAS_Z_AXIS, raw.z = batch.z[i]);
+        inverse_kinematics(raw);
+        batch.a[i] = delta.a; batch.b[i] = delta.b; TERN_(HAS_Z_AXIS, batch.c[i] = delta.c);
+      }
+    }
+  #endif
+
 #endif
 
 /**
@@ -212,22 +225,32 @@ xyz_pos_t cartes;
  * Output the current position to serial
  */
 
-inline void report_more_positions() {
-  stepper.report_positions();
+// Add the stepper counts to the report, send it, and report any other coordinates
+static void report_more_positions(ReportBuffer &rb) {
+  stepper.add_positions(rb);
+  rb.send();
   TERN_(IS_SCARA, scara_report_positions());
   TERN_(POLAR, polar_report_positions());
 }
 
-// Report the logical position for a given machine position
-inline void report_logical_position(const xyze_pos_t &rpos) {
-  const xyze_pos_t lpos = rpos.asLogical();
+// Add the logical position for a given machine position to the report
+static void add_logical_position(ReportBuffer &rb, const xyze_pos_t &rpos) {
   #if NUM_AXES
-    SERIAL_ECHOPGM_P(LOGICAL_AXIS_PAIRED_LIST(
-      SP_E_LBL, lpos.e,
-         X_LBL, lpos.x,  SP_Y_LBL, lpos.y,  SP_Z_LBL, lpos.z,
-      SP_I_LBL, lpos.i,  SP_J_LBL, lpos.j,  SP_K_LBL, lpos.k,
-      SP_U_LBL, lpos.u,  SP_V_LBL, lpos.v,  SP_W_LBL, lpos.w
+    static ReportTemplate tpl(PSTR(LOGICAL_AXIS_GANG(
+      " E:%",
+      "X:%", " Y:%", " Z:%",
+      " " STR_I ":%", " " STR_J ":%", " " STR_K ":%",
+      " " STR_U ":%", " " STR_V ":%", " " STR_W ":%"
+    )));
+    const xyze_pos_t lpos = rpos.asLogical();
+    rb.fill(tpl, LOGICAL_AXIS_LIST(
+      lpos.e,
+      lpos.x, lpos.y, lpos.z,
+      lpos.i, lpos.j, lpos.k,
+      lpos.u, lpos.v, lpos.w
     ));
+  #else
+    UNUSED(rb); UNUSED(rpos);
   #endif
 }
 
@@ -244,14 +267,16 @@ void report_real_position() {
 
   TERN_(HAS_POSITION_MODIFIERS, planner.unapply_modifiers(npos, true));
 
-  report_logical_position(npos);
-  report_more_positions();
+  ReportBuffer rb;
+  add_logical_position(rb, npos);
+  report_more_positions(rb);
 }
 
 // Report the logical current position according to the most recent G-code command
 void report_current_position() {
-  report_logical_position(current_position);
-  report_more_positions();
+  ReportBuffer rb;
+  add_logical_position(rb, current_position);
+  report_more_positions(rb);
 }
 
 /**
@@ -261,8 +286,10 @@ void report_current_position() {
  * definitively interrupts the printing flow.
  */
 void report_current_position_projected() {
-  report_logical_position(current_position);
-  stepper.report_a_position(planner.position);
+  ReportBuffer rb;
+  add_logical_position(rb, current_position);
+  stepper.add_a_position(rb, planner.position);
+  rb.send();
 }
 
 #if HAS_HOMING_CURRENT
@@ -1550,14 +1577,36 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     #define POLAR_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #ifdef DELTA_SEGMENT_TOLERANCE
+    /**
+     * Check that the towers stay within DELTA_SEGMENT_TOLERANCE of a straight line
+     * from 'start' to batch point 'to' at all the batch points from 'from' to 'to'-1.
+     * Segment ends are evenly spaced in cartesian space, so with linear tower motion
+     * each one would be an equal fraction of the way along the line.
+     */
+    static bool delta_segment_is_linear(const kinematic_batch_t &batch, const abc_float_t &start, const uint8_t from, const uint8_t to) {
+      const float * const joint[] = { batch.a, batch.b, batch.c };
+      const float inv_n = 1.0f / (to - from + 1);
+      LOOP_ABC(t) {
+        const float j0 = start[t], dj = (joint[t][to] - j0) * inv_n;
+        for (uint8_t k = from; k < to; ++k)
+          if (ABS(j0 + dj * (k - from + 1) - joint[t][k]) > float(DELTA_SEGMENT_TOLERANCE)) return false;
+      }
+      return true;
+    }
+  #endif
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
    * Called from prepare_line_to_destination as the
    * default Delta/SCARA segmenter.
    *
-   * This calls planner.buffer_line several times, adding
-   * small incremental moves for DELTA or SCARA.
+   * This calls planner.buffer_kinematic several times, adding
+   * small incremental moves for DELTA or SCARA. The segment ends
+   * are converted to joint positions in batches and, with
+   * DELTA_SEGMENT_TOLERANCE, segments along which the towers
+   * move nearly linearly are merged.
    *
    * For Unified Bed Leveling (Delta or Segmented Cartesian)
    * the bedlevel.line_to_destination_segmented method replaces this.
@@ -1639,19 +1688,64 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     //*/
 
     // Get the current position as starting point
-    xyze_pos_t raw = current_position;
+    const xyze_pos_t start = current_position;
 
-    // Calculate and execute the segments
+    // Segment end 'n' of the move. The last one arrives exactly at the target location.
+    auto segment_end = [&](const uint16_t n) -> xyze_pos_t {
+      return n == segments ? destination : start + segment_distance * float(n);
+    };
+
+    #ifdef DELTA_SEGMENT_TOLERANCE
+      // Tower positions at the end of the last queued segment
+      xyze_pos_t start_machine = start;
+      TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(start_machine));
+      inverse_kinematics(start_machine);
+      abc_float_t start_joints;
+      start_joints.set(delta.a, delta.b, delta.c);
+      const float segment_mm = hints.millimeters;
+    #endif
+
+    // Convert the segments to joint positions a batch at a time, then queue them
+    kinematic_batch_t batch;
     millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
+    for (uint16_t first = 1; first <= segments;) {
       segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-    }
 
-    // Ensure last segment arrives at target location.
-    planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+      const uint8_t count = _MIN(segments - first + 1, KINEMATIC_BATCH_SIZE);
+      for (uint8_t i = 0; i < count; ++i) {
+        xyze_pos_t machine = segment_end(first + i);
+        TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(machine));
+        batch.x[i] = machine.x; batch.y[i] = machine.y; batch.z[i] = machine.z;
+        TERN_(HAS_EXTRUDERS, batch.e[i] = machine.e);
+      }
+      inverse_kinematics(batch, count);
+
+      #ifdef DELTA_SEGMENT_TOLERANCE
+        uint8_t from = 0; // First batch point not yet queued
+      #endif
+
+      for (uint8_t i = 0; i < count; ++i) {
+
+        #ifdef DELTA_SEGMENT_TOLERANCE
+          // Skip this point if the towers can go straight on to the next one
+          if (i < count - 1 && delta_segment_is_linear(batch, start_joints, from, i + 1)) continue;
+          hints.millimeters = segment_mm * (i - from + 1);
+          TERN_(FEEDRATE_SCALING, hints.inv_duration = scaled_fr_mm_s / hints.millimeters);
+          start_joints.set(batch.a[i], batch.b[i], batch.c[i]);
+          from = i + 1;
+        #endif
+
+        delta.set(batch.a[i], batch.b[i], batch.c[i]);
+        TERN_(HAS_EXTRUDERS, delta.e = batch.e[i]);
+        if (!planner.buffer_kinematic(segment_end(first + i), delta, scaled_fr_mm_s, active_extruder, hints)) {
+          // Ensure last segment arrives at target location.
+          planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+          return false;
+        }
+      }
+
+      first += count;
+    }
 
     return false; // caller will update current_position
   }
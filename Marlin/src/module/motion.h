@@ -54,6 +54,29 @@ extern xyz_pos_t cartes;
 // Until kinematics.cpp is created, declare this here
 #if IS_KINEMATIC
   extern abce_pos_t delta;
+
+  /**
+   * Machine positions for several segments, converted to joint positions
+   * with a single inverse_kinematics call. Kept as separate arrays so the
+   * per-point math runs over contiguous floats the compiler can vectorize.
+   */
+  #ifndef KINEMATIC_BATCH_SIZE
+    #ifdef __AVR__
+      #define KINEMATIC_BATCH_SIZE 4
+    #else
+      #define KINEMATIC_BATCH_SIZE 8
+    #endif
+  #endif
+  struct kinematic_batch_t {
+    float x[KINEMATIC_BATCH_SIZE], y[KINEMATIC_BATCH_SIZE], z[KINEMATIC_BATCH_SIZE]; // Machine position
+    #if HAS_EXTRUDERS
+      float e[KINEMATIC_BATCH_SIZE];                                                 // Passed through
+    #endif
+    float a[KINEMATIC_BATCH_SIZE], b[KINEMATIC_BATCH_SIZE], c[KINEMATIC_BATCH_SIZE]; // Joint position
+  };
+
+  // Convert the first 'count' points of the batch, in order
+  void inverse_kinematics(kinematic_batch_t &batch, const uint8_t count);
 #endif
 
 // Determine XY_PROBE_FEEDRATE_MM_S - The feedrate used between Probe Points
@@ -894,6 +894,9 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const float e
 
     #if ENABLED(SMOOTH_LIN_ADVANCE)
       block->cruise_time = plateau_steps > 0 ? float(plateau_steps) * float(STEPPER_TIMER_RATE) / float(cruise_rate) : 0;
+      // Precompute what the LA lookahead needs so the ISR can skip whole blocks
+      block->total_time = acceleration_time + block->cruise_time + deceleration_time;
+      block->cruise_e_rate = block->use_advance_lead ? int32_t((int64_t(cruise_rate) * block->e_step_ratio_q30) >> 30) : 0;
     #elif HAS_ROUGH_LIN_ADVANCE
       if (block->la_advance_rate) {
         const float comp = get_advance_k(block->extruder) * block->steps.e / block->step_event_count;
@@ -2974,6 +2977,26 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
 
   #if IS_KINEMATIC
 
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
+    return buffer_kinematic(cart, delta, fr_mm_s, extruder, hints);
+
+  #else // !IS_KINEMATIC
+
+    return buffer_segment(machine, fr_mm_s, extruder, hints);
+
+  #endif
+
+} // buffer_line()
+
+#if IS_KINEMATIC
+
+  bool Planner::buffer_kinematic(const xyze_pos_t &cart, const abce_pos_t &joints, const feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+
     #if HAS_JUNCTION_DEVIATION
       const xyze_pos_t cart_dist_mm = LOGICAL_AXIS_ARRAY(
         cart.e - position_cart.e,
@@ -2989,9 +3012,6 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
       );
     #endif
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     PlannerHints ph = hints;
     if (!hints.millimeters)
       ph.millimeters = get_move_distance(xyze_pos_t(cart_dist_mm) OPTARG(HAS_ROTATIONAL_AXES, ph.cartesian_move));
@@ -3005,7 +3025,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
       // For SCARA scale the feedrate from mm/s to degrees/s
       // i.e., Complete the angular vector in the given time.
       const float duration_recip = hints.inv_duration ?: fr_mm_s / ph.millimeters;
-      const xyz_pos_t diff = delta - position_float;
+      const xyz_pos_t diff = joints - position_float;
       const feedRate_t feedrate = diff.magnitude() * duration_recip;
 
     #elif ENABLED(POLAR)
@@ -3033,9 +3053,9 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
        * This shouldn't be a problem for cutting/milling operations.
        */
       feedRate_t calculated_feedrate = fr_mm_s;
-      const xyz_pos_t diff = delta - position_float;
+      const xyz_pos_t diff = joints - position_float;
       if (!NEAR_ZERO(diff.b)) {
-        if (delta.a <= POLAR_FAST_RADIUS)
+        if (joints.a <= POLAR_FAST_RADIUS)
           calculated_feedrate = settings.max_feedrate_mm_s[Y_AXIS];
         else {
           // Normalized vector of movement
@@ -3044,7 +3064,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
                       normalizedTheta = 1.0f - (ABS(diffTheta > 90.0f ? 180.0f - diffTheta : diffTheta) / 90.0f);
 
           // Normalized position along the radius
-          const float radiusRatio = (PRINTABLE_RADIUS) / delta.a;
+          const float radiusRatio = (PRINTABLE_RADIUS) / joints.a;
           calculated_feedrate += (fr_mm_s * radiusRatio * normalizedTheta);
         }
       }
@@ -3052,20 +3072,15 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const feedRate_t fr_mm_s
 
     #endif // POLAR && FEEDRATE_SCALING
 
-    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
-    if (buffer_segment(delta OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), feedrate, extruder, ph)) {
+    if (buffer_segment(joints OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), feedrate, extruder, ph)) {
       position_cart = cart;
       return true;
     }
     return false;
 
-  #else // !IS_KINEMATIC
-
-    return buffer_segment(machine, fr_mm_s, extruder, hints);
+  } // buffer_kinematic()
 
-  #endif
-
-} // buffer_line()
+#endif // IS_KINEMATIC
 
 #if ENABLED(DIRECT_STEPPING)
 
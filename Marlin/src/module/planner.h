@@ -240,8 +240,10 @@ typedef struct PlannerBlock {
            decelerate_start;                // The index of the step event on which to start decelerating
 
   #if ENABLED(SMOOTH_LIN_ADVANCE)
-    uint32_t cruise_time;                   // Cruise time in STEP timer counts
-    int32_t e_step_ratio_q30;               // Ratio of e steps to block steps.
+    uint32_t cruise_time,                   // Cruise time in STEP timer counts
+             total_time;                    // Acceleration + cruise + deceleration time in STEP timer counts
+    int32_t e_step_ratio_q30,               // Ratio of e steps to block steps.
+            cruise_e_rate;                  // E step rate while cruising. Zero if the block has no advance lead.
     #if ENABLED(INPUT_SHAPING_E_SYNC)
       uint32_t xy_length_inv_q30;           // Inverse of block->steps.x + block.steps.y
     #endif
@@ -987,6 +989,28 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if IS_KINEMATIC
+      /**
+       * @fn Planner::buffer_kinematic
+       *
+       * @brief Add a new linear movement with pre-calculated joint positions.
+       * @details Used by buffer_line and by the kinematic segmenter, which
+       *          converts several segments at once with a batch inverse_kinematics.
+       *
+       * @param cart      Target position in mm or degrees
+       * @param joints    Target joint positions for 'cart', with modifiers and kinematics applied
+       * @param fr_mm_s   (Target) speed of the move (mm/s)
+       * @param extruder  Optional target extruder (otherwise active_extruder)
+       * @param hints     Optional parameters to aid planner calculations
+       *
+       * @return  false if no segment was queued due to cleaning, cold extrusion, full queue, etc...
+       */
+      static bool buffer_kinematic(const xyze_pos_t &cart, const abce_pos_t &joints, const feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
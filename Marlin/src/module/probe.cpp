@@ -664,7 +664,9 @@ bool Probe::probe_down_to_z(const float z, const feedRate_t fr_mm_s) {
   TERN_(HAS_QUIET_PROBING, set_devices_paused_for_probing(true));
 
   // Move down until the probe is triggered
+  TERN_(M48_PROBE_BENCHMARK, const millis_t move_ms = millis());
   do_blocking_move_to_z(z, fr_mm_s);
+  TERN_(M48_PROBE_BENCHMARK, phase_ms[fr_mm_s == z_probe_slow_mm_s ? PROBE_PHASE_SLOW : PROBE_PHASE_FAST] += millis() - move_ms);
 
   // Check to see if the probe was triggered
   const bool probe_triggered = (
@@ -1081,6 +1083,61 @@ float Probe::probe_at_point(
   return measured_z;
 }
 
+#if ENABLED(M48_PROBE_BENCHMARK)
+
+  millis_t Probe::phase_ms[PROBE_PHASE_COUNT];
+
+  /**
+   * @brief Probe at the given XY with probe_at_point and the given slow feedrate and number
+   *        of probes, timing each phase of the probing in phase_ms.
+   *
+   * @details The slow feedrate and MULTIPLE_PROBING are the run-time PRO_data settings, so they
+   *          are swapped in for this probe and restored afterward. probe_down_to_z times the fast
+   *          and slow probe moves. The rest of probe_at_point counts as the raise phase.
+   *
+   * @param pos         Probe position, relative to the probe
+   * @param raise_after Raise (PROBE_PT_RAISE) or stow (PROBE_PT_STOW) after probing
+   * @param slow_mm_m   Feedrate of the slow probes (mm/min)
+   * @param probes      Number of probes, as with MULTIPLE_PROBING
+   *
+   * @return The Z position of the bed at the given XY or NAN on error.
+   */
+  float Probe::benchmark_at_point(const xy_pos_t &pos, const ProbePtRaise raise_after, const uint16_t slow_mm_m, const uint8_t probes) {
+    const uint16_t old_slow = PRO_data.zprobefeedslow;
+    const uint8_t old_probes = PRO_data.multiple_probing;
+    PRO_data.zprobefeedslow = slow_mm_m;
+    PRO_data.multiple_probing = probes > 1 ? probes : 0;
+
+    ZERO(phase_ms);
+
+    // Deploy ahead of probe_at_point, which reports a failure
+    millis_t ms = millis();
+    deploy();
+    phase_ms[PROBE_PHASE_DEPLOY] = millis() - ms;
+
+    const bool stow_after = raise_after == PROBE_PT_STOW || raise_after == PROBE_PT_LAST_STOW;
+    ms = millis();
+    float measured_z = probe_at_point(pos, stow_after ? PROBE_PT_NONE : raise_after);
+    phase_ms[PROBE_PHASE_RAISE] = millis() - ms - phase_ms[PROBE_PHASE_FAST] - phase_ms[PROBE_PHASE_SLOW];
+
+    if (stow_after && !isnan(measured_z)) {
+      ms = millis();
+      if (stow()) {
+        measured_z = NAN;
+        LCD_MESSAGE(MSG_LCD_PROBING_FAILED);
+        SERIAL_ERROR_MSG(STR_ERR_PROBING_FAILED);
+      }
+      phase_ms[PROBE_PHASE_STOW] = millis() - ms;
+    }
+
+    PRO_data.zprobefeedslow = old_slow;
+    PRO_data.multiple_probing = old_probes;
+
+    return measured_z;
+  }
+
+#endif // M48_PROBE_BENCHMARK
+
 #if HAS_Z_SERVO_PROBE
 
   void Probe::servo_probe_init() {
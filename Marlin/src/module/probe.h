@@ -47,6 +47,16 @@
     PROBE_PT_LAST_STOW, // Stow for sure, even in BLTouch HS mode
     PROBE_PT_RAISE      // Raise to "between" clearance after run_z_probe
   };
+  #if ENABLED(M48_PROBE_BENCHMARK)
+    enum ProbePhase : uint8_t {
+      PROBE_PHASE_DEPLOY, // Deploy the probe
+      PROBE_PHASE_FAST,   // Fast probe or approach
+      PROBE_PHASE_SLOW,   // Slow probes
+      PROBE_PHASE_RAISE,  // XY move, raise between probes and after probing
+      PROBE_PHASE_STOW,   // Stow the probe
+      PROBE_PHASE_COUNT
+    };
+  #endif
 #endif
 
 #if HAS_DELTA_SENSORLESS_PROBING
@@ -205,6 +215,11 @@ public:
       return probe_at_point(pos.x, pos.y, raise_after, verbose_level, probe_relative, sanity_check, z_min_point, z_clearance, raise_after_is_rel);
     }
 
+    #if ENABLED(M48_PROBE_BENCHMARK)
+      static millis_t phase_ms[PROBE_PHASE_COUNT];  // Time of each phase of the last benchmark_at_point
+      static float benchmark_at_point(const xy_pos_t &pos, const ProbePtRaise raise_after, const uint16_t slow_mm_m, const uint8_t probes);
+    #endif
+
   #else // !HAS_BED_PROBE
 
     static constexpr xyz_pos_t offset = xyz_pos_t(NUM_AXIS_ARRAY_1(0)); // See #16767
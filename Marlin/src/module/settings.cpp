@@ -931,6 +931,142 @@ void MarlinSettings::postprocess() {
   int MarlinSettings::eeprom_index;
   uint16_t MarlinSettings::working_crc;
 
+  /**
+   * The settings image is handled in fixed sections, each with the CRC of
+   * what was last read from or written to it. On save each section is
+   * buffered and passed to the persistent store only if it changed. A CRC
+   * that differs means a change with no read-back. A matching CRC is only a
+   * hint, so the stored bytes are read back and compared before skipping.
+   * The stored format is unchanged.
+   */
+  #define EEPROM_SECTION_SIZE 32
+  constexpr uint16_t eeprom_sections = CEILING(sizeof(SettingsData), EEPROM_SECTION_SIZE);
+
+  static uint16_t section_crc[eeprom_sections];
+  static Flags<eeprom_sections> section_known;
+  static struct {
+    int16_t index = -1;   // Section being gathered, -1 for none
+    uint8_t fill;         // Bytes gathered from the start of the section
+    bool writing;
+    uint16_t crc;         // CRC of the bytes read so far
+    uint8_t data[EEPROM_SECTION_SIZE];
+  } section;
+
+  static uint8_t section_length(const uint16_t s) {
+    return _MIN(size_t(EEPROM_SECTION_SIZE), sizeof(SettingsData) - s * EEPROM_SECTION_SIZE);
+  }
+
+  // Section index for an EEPROM position, -1 if outside the settings
+  static int16_t section_at(const int pos) {
+    const int rel = pos - (EEPROM_OFFSET);
+    return WITHIN(rel, 0, int(sizeof(SettingsData)) - 1) ? rel / EEPROM_SECTION_SIZE : -1;
+  }
+
+  void MarlinSettings::invalidate_sections() { section_known.reset(); }
+
+  // Write out a partly gathered section. Its stored CRC is no longer known.
+  void MarlinSettings::section_flush() {
+    if (section.index < 0) return;
+    if (section.writing) {
+      int pos = EEPROM_OFFSET + section.index * EEPROM_SECTION_SIZE;
+      uint16_t crc = 0;
+      persistentStore.write_data(pos, section.data, section.fill, &crc);
+      section_known.clear(section.index);
+    }
+    section.index = -1;
+  }
+
+  void MarlinSettings::section_write(int &pos, const uint8_t *value, size_t size) {
+    crc16(&working_crc, value, size);
+    while (size) {
+      const int16_t s = section_at(pos);
+      if (s < 0) {
+        section_flush();
+        uint16_t crc = 0;
+        persistentStore.write_data(pos, value, size, &crc);
+        return;
+      }
+      const uint8_t o = (pos - (EEPROM_OFFSET)) % EEPROM_SECTION_SIZE,
+                    len = section_length(s),
+                    n = _MIN(size, size_t(len - o));
+      if (section.index != s || !section.writing || section.fill != o) {
+        section_flush();
+        if (o) {
+          // Not from the start of the section, so write through
+          uint16_t crc = 0;
+          persistentStore.write_data(pos, value, n, &crc);
+          section_known.clear(s);
+          value += n; size -= n;
+          continue;
+        }
+        section.index = s;
+        section.fill = 0;
+        section.writing = true;
+      }
+      memcpy(&section.data[o], value, n);
+      section.fill += n;
+      pos += n; value += n; size -= n;
+      if (section.fill == len) {
+        uint16_t crc = 0;
+        crc16(&crc, section.data, len);
+        int p = EEPROM_OFFSET + s * EEPROM_SECTION_SIZE;
+        bool changed = !section_known[s] || crc != section_crc[s];
+        if (!changed) {
+          // Same CRC. Compare the stored bytes in case of a collision.
+          uint8_t stored[EEPROM_SECTION_SIZE];
+          uint16_t dummy = 0;
+          int rp = p;
+          changed = persistentStore.read_data(rp, stored, len, &dummy) || memcmp(stored, section.data, len);
+        }
+        if (changed) {
+          uint16_t dummy = 0;
+          section_known.set(s, !persistentStore.write_data(p, section.data, len, &dummy));
+          section_crc[s] = crc;
+        }
+        section.index = -1;
+      }
+    }
+  }
+
+  void MarlinSettings::section_read(int &pos, uint8_t *value, size_t size, const bool writing) {
+    while (size) {
+      const int16_t s = section_at(pos);
+      if (s < 0) {
+        section_flush();
+        persistentStore.read_data(pos, value, size, &working_crc, writing);
+        return;
+      }
+      const uint8_t o = (pos - (EEPROM_OFFSET)) % EEPROM_SECTION_SIZE,
+                    len = section_length(s),
+                    n = _MIN(size, size_t(len - o));
+      uint8_t buf[EEPROM_SECTION_SIZE];
+      uint16_t dummy = 0;
+      persistentStore.read_data(pos, buf, n, &dummy);
+      crc16(&working_crc, buf, n);
+      if (writing) memcpy(value, buf, n);
+
+      if (section.index != s || section.writing || section.fill != o) {
+        section_flush();
+        if (!o) {
+          section.index = s;
+          section.fill = 0;
+          section.writing = false;
+          section.crc = 0;
+        }
+      }
+      if (section.index == s) {
+        crc16(&section.crc, buf, n);
+        section.fill += n;
+        if (section.fill == len) {
+          section_crc[s] = section.crc;
+          section_known.set(s);
+          section.index = -1;
+        }
+      }
+      value += n; size -= n;
+    }
+  }
+
   EEPROM_Error MarlinSettings::size_error(const uint16_t size) {
     if (size != datasize()) {
       DEBUG_WARN_MSG("EEPROM datasize error."
@@ -3372,6 +3508,70 @@ void MarlinSettings::postprocess() {
       return meshes_end - (slot + 1) * MESH_STORE_SIZE;
     }
 
+    #if ENABLED(OPTIMIZED_MESH_STORAGE)
+
+      /**
+       * The mesh format marker lives in the space reserved for the MAT, just past
+       * the mesh slots. Its address doesn't depend on the slot size, so compact
+       * slots are never taken for old ones, even after a GRID_MAX_POINTS change.
+       */
+      #define MESH_FORMAT_MARKER 0x314D5355UL // "USM1"
+
+      /**
+       * Convert meshes saved in the old int16 layout to compact slots. Runs once,
+       * before the first mesh load or store, unless the format marker is present.
+       *
+       * A compact slot no larger than a legacy slot only overlaps legacy slots
+       * with the same or lower index, so slots are converted from 0 up. A larger
+       * compact slot (e.g., a 3x3 grid) overlaps the following legacy slot, so
+       * slots are converted from the last one down.
+       */
+      static void migrate_legacy_meshes() {
+        static bool checked = false;
+        if (checked) return;
+        checked = true;
+
+        persistentStore.access_start();
+
+        const int marker_pos = settings.meshes_end_index();
+        uint32_t marker = 0;
+        uint16_t crc = 0;
+        int pos = marker_pos;
+        persistentStore.read_data(pos, (uint8_t*)&marker, sizeof(marker), &crc);
+        if (marker == MESH_FORMAT_MARKER) {
+          persistentStore.access_finish();
+          return;
+        }
+
+        mesh_store_t store;
+        bed_mesh_t z_values;
+        constexpr bool grows = sizeof(mesh_store_t) > sizeof(mesh_store_legacy_t);
+        const int16_t legacy_slots = (settings.meshes_end_index() - settings.meshes_start_index()) / sizeof(mesh_store_legacy_t),
+                      count = _MIN(int16_t(settings.calc_num_meshes()), legacy_slots);
+        uint8_t migrated = 0;
+        for (int16_t i = 0; i < count; ++i) {
+          const int8_t s = grows ? count - 1 - i : i;
+          mesh_store_legacy_t legacy;
+          pos = settings.meshes_end_index() - (s + 1) * sizeof(mesh_store_legacy_t);
+          persistentStore.read_data(pos, (uint8_t*)&legacy, sizeof(legacy), &crc);
+          if (!bedlevel.set_mesh_from_legacy_store(legacy, z_values)) continue;
+          bedlevel.set_store_from_mesh(z_values, store);
+          pos = settings.mesh_slot_offset(s);
+          if (!persistentStore.write_data(pos, (uint8_t*)&store, sizeof(store), &crc)) migrated++;
+        }
+
+        marker = MESH_FORMAT_MARKER;
+        pos = marker_pos;
+        persistentStore.write_data(pos, (uint8_t*)&marker, sizeof(marker), &crc);
+
+        persistentStore.access_finish();
+
+        if (migrated) SERIAL_ECHOLNPGM("Converted ", migrated, " saved mesh(es) to compact storage.");
+        if (legacy_slots > count) SERIAL_ECHOLNPGM("Meshes past slot ", count - 1, " don't fit compact storage.");
+      }
+
+    #endif
+
     void MarlinSettings::store_mesh(const int8_t slot) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
@@ -3383,18 +3583,22 @@ void MarlinSettings::postprocess() {
           return;
         }
 
+        #if ENABLED(OPTIMIZED_MESH_STORAGE)
+          migrate_legacy_meshes();
+        #endif
+
         int pos = mesh_slot_offset(slot);
         uint16_t crc = 0;
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+          // The compact slot carries its own CRC
+          mesh_store_t z_mesh_store;
           bedlevel.set_store_from_mesh(bedlevel.z_values, z_mesh_store);
           uint8_t * const src = (uint8_t*)&z_mesh_store;
         #else
           uint8_t * const src = (uint8_t*)&bedlevel.z_values;
         #endif
 
-        // Write crc to MAT along with other data, or just tack on to the beginning or end
         persistentStore.access_start();
         const bool status = persistentStore.write_data(pos, src, MESH_STORE_SIZE, &crc);
         persistentStore.access_finish();
@@ -3420,10 +3624,14 @@ void MarlinSettings::postprocess() {
           return;
         }
 
+        #if ENABLED(OPTIMIZED_MESH_STORAGE)
+          migrate_legacy_meshes();
+        #endif
+
         int pos = mesh_slot_offset(slot);
         uint16_t crc = 0;
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+          mesh_store_t z_mesh_store;
           uint8_t * const dest = (uint8_t*)&z_mesh_store;
         #else
           uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&bedlevel.z_values;
@@ -3434,13 +3642,9 @@ void MarlinSettings::postprocess() {
         persistentStore.access_finish();
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          if (into) {
-            float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-            bedlevel.set_mesh_from_store(z_mesh_store, z_values);
-            memcpy(into, z_values, sizeof(z_values));
-          }
-          else
-            bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+          // An empty or corrupt slot loads as an invalid mesh
+          if (!bedlevel.set_mesh_from_store(z_mesh_store, into ? *(bed_mesh_t*)into : bedlevel.z_values))
+            status = true;
         #endif
 
         #if ENABLED(DWIN_LCD_PROUI)
@@ -67,6 +67,8 @@ class MarlinSettings {
       static bool load();      // Return 'true' if data was loaded ok
       static bool validate();  // Return 'true' if EEPROM data is ok
 
+      static void invalidate_sections(); // Call after writing the EEPROM directly
+
       static EEPROM_Error check_version();
 
       static void first_load() {
@@ -144,30 +146,35 @@ class MarlinSettings {
         return true;
       }
 
-      static void EEPROM_FINISH(void) { persistentStore.access_finish(); }
+      static void EEPROM_FINISH(void) { section_flush(); persistentStore.access_finish(); }
 
       template<typename T>
       static void EEPROM_SKIP(const T &VAR) { eeprom_index += sizeof(VAR); }
 
       template<typename T>
       static void EEPROM_WRITE_(const T &VAR) {
-        persistentStore.write_data(eeprom_index, (const uint8_t *) &VAR, sizeof(VAR), &working_crc);
+        section_write(eeprom_index, (const uint8_t *) &VAR, sizeof(VAR));
       }
 
       template<typename T>
       static void EEPROM_READ_(T &VAR) {
-        persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc, !validating);
+        section_read(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), !validating);
       }
 
       static void EEPROM_READ_(uint8_t *VAR, size_t sizeof_VAR) {
-        persistentStore.read_data(eeprom_index, VAR, sizeof_VAR, &working_crc, !validating);
+        section_read(eeprom_index, VAR, sizeof_VAR, !validating);
       }
 
       template<typename T>
       static void EEPROM_READ_ALWAYS_(T &VAR) {
-        persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc);
+        section_read(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), true);
       }
 
+      // Settings data passes through fixed-size sections so unchanged ones can be skipped
+      static void section_write(int &pos, const uint8_t *value, size_t size);
+      static void section_read(int &pos, uint8_t *value, size_t size, const bool writing);
+      static void section_flush();
+
     #endif // EEPROM_SETTINGS
 };
 
@@ -85,6 +85,7 @@ Stepper stepper; // Singleton
 #include "../gcode/queue.h"
 #include "../sd/cardreader.h"
 #include "../HAL/shared/Delay.h"
+#include "../core/report_buffer.h"
 
 #if ENABLED(BD_SENSOR)
   #include "../feature/bedlevel/bdl/bdl.h"
@@ -561,6 +562,11 @@ constexpr hal_timer_t PULSE_LOW_TICK_COUNT = ns_to_pulse_timer_ticks(_min_pulse_
 #define AWAIT_HIGH_PULSE() AWAIT_TIMED_PULSE(HIGH)
 #define AWAIT_LOW_PULSE()  AWAIT_TIMED_PULSE(LOW)
 
+#if ENABLED(STEP_TIMER_PULSE)
+  // With no high wait after timer-only pulses, the next pulse waits for high + low from the start
+  #define AWAIT_TIMER_PULSE() while (PULSE_HIGH_TICK_COUNT + PULSE_LOW_TICK_COUNT > HAL_timer_get_count(MF_TIMER_PULSE) - start_pulse_count) { /* nada */ }
+#endif
+
 #if MINIMUM_STEPPER_PRE_DIR_DELAY > 0
   #define DIR_WAIT_BEFORE() DELAY_NS(MINIMUM_STEPPER_PRE_DIR_DELAY)
 #else
@@ -1870,6 +1876,11 @@ void Stepper::isr() {
       bool firstStep = true;
     #endif
 
+    // Any GPIO STEP pins in the last pulse? Timer-driven pins end their own pulses.
+    #if ENABLED(STEP_TIMER_PULSE) && ISR_PULSE_CONTROL
+      bool gpio_pulse = true;
+    #endif
+
     // Direct Stepping page?
     const bool is_page = current_block->is_page();
 
@@ -2103,6 +2114,10 @@ void Stepper::isr() {
       #if ISR_MULTI_STEPS
         if (firstStep)
           firstStep = false;
+        #if ENABLED(STEP_TIMER_PULSE)
+          else if (!gpio_pulse)
+            { AWAIT_TIMER_PULSE(); }
+        #endif
         else
           AWAIT_LOW_PULSE();
       #endif
@@ -2125,7 +2140,12 @@ void Stepper::isr() {
       // TODO: need to deal with MINIMUM_STEPPER_PULSE_NS over i2s
       #if ISR_PULSE_CONTROL
         START_TIMED_PULSE();
-        AWAIT_HIGH_PULSE();
+        #if ENABLED(STEP_TIMER_PULSE)
+          gpio_pulse = (step_needed.flags.b & ~step_pulse_axes.flags.b);
+          if (gpio_pulse) AWAIT_HIGH_PULSE();
+        #else
+          AWAIT_HIGH_PULSE();
+        #endif
       #endif
 
       // Pulse stop
@@ -2139,7 +2159,7 @@ void Stepper::isr() {
       #endif
 
       #if ISR_MULTI_STEPS
-        if (events_to_do) START_TIMED_PULSE();
+        if (events_to_do && TERN1(STEP_TIMER_PULSE, gpio_pulse)) START_TIMED_PULSE();
       #endif
 
     } while (--events_to_do);
@@ -3038,8 +3058,17 @@ void Stepper::isr() {
     int32_t Stepper::smooth_lin_adv_lookahead(uint32_t stepper_ticks) {
       for (uint8_t i = 0; block_t *block = planner.get_future_block(i); i++) {
         if (block->is_sync()) continue;
+
+        // Skip whole blocks using the time precomputed by the planner
+        if (stepper_ticks > block->total_time) {
+          stepper_ticks -= block->total_time;
+          continue;
+        }
+
+        // The target time falls in this block
+        if (!block->use_advance_lead) return 0;
+
         if (stepper_ticks <= block->acceleration_time) {
-          if (!block->use_advance_lead) return 0;
           uint32_t rate;
           #if ENABLED(S_CURVE_ACCELERATION)
             rate = calc_bezier_curve(block->initial_rate, block->cruise_rate, block->acceleration_time_inverse, stepper_ticks);
@@ -3051,29 +3080,22 @@ void Stepper::isr() {
         }
         stepper_ticks -= block->acceleration_time;
 
-        if (stepper_ticks <= block->cruise_time) {
-          if (!block->use_advance_lead) return 0;
-          return MULT_Q(30, block->cruise_rate, block->e_step_ratio_q30);
-        }
+        if (stepper_ticks <= block->cruise_time) return block->cruise_e_rate;
         stepper_ticks -= block->cruise_time;
 
-        if (stepper_ticks <= block->deceleration_time) {
-          if (!block->use_advance_lead) return 0;
-          uint32_t rate;
-          #if ENABLED(S_CURVE_ACCELERATION)
-            rate = calc_bezier_curve(block->cruise_rate, block->final_rate, block->deceleration_time_inverse, stepper_ticks);
-          #else
-            rate = STEP_MULTIPLY(stepper_ticks, block->acceleration_rate);
-            if (rate < block->cruise_rate) {
-              rate = block->cruise_rate - rate;
-              NOLESS(rate, block->final_rate);
-            }
-            else
-              rate = block->final_rate;
-          #endif
-          return MULT_Q(30, rate, block->e_step_ratio_q30);
-        }
-        stepper_ticks -= block->deceleration_time;
+        uint32_t rate;
+        #if ENABLED(S_CURVE_ACCELERATION)
+          rate = calc_bezier_curve(block->cruise_rate, block->final_rate, block->deceleration_time_inverse, stepper_ticks);
+        #else
+          rate = STEP_MULTIPLY(stepper_ticks, block->acceleration_rate);
+          if (rate < block->cruise_rate) {
+            rate = block->cruise_rate - rate;
+            NOLESS(rate, block->final_rate);
+          }
+          else
+            rate = block->final_rate;
+        #endif
+        return MULT_Q(30, rate, block->e_step_ratio_q30);
       }
       return 0;
     }
@@ -3302,6 +3324,18 @@ void Stepper::init() {
   #define _EN_AXIS_INIT(N) TERF(HAS_E##N##_STEP, E_AXIS_INIT)(N);
   REPEAT(8, _EN_AXIS_INIT);
 
+  #if ENABLED(STEP_TIMER_PULSE)
+    // Hand STEP pins with a free timer channel over to hardware pulses
+    #define _STEP_PULSE_ATTACH(A, AXIS, STATE) \
+      if (!HAL_step_pulse_attach(AXIS, A##_STEP_PIN, STATE, _min_pulse_high_ns)) \
+        SERIAL_ECHOLNPGM(STR_##A " STEP pin has no free timer. Using GPIO.")
+    TERN_(X_STEP_TIMER,  _STEP_PULSE_ATTACH(X,  X_AXIS, STEP_STATE_X));
+    TERN_(Y_STEP_TIMER,  _STEP_PULSE_ATTACH(Y,  Y_AXIS, STEP_STATE_Y));
+    TERN_(Z_STEP_TIMER,  _STEP_PULSE_ATTACH(Z,  Z_AXIS, STEP_STATE_Z));
+    TERN_(E0_STEP_TIMER, _STEP_PULSE_ATTACH(E0, E_AXIS, STEP_STATE_E));
+    #undef _STEP_PULSE_ATTACH
+  #endif
+
   #if DISABLED(I2S_STEPPER_STREAM)
     HAL_timer_start(MF_TIMER_STEP, 122); // Init Stepper ISR to 122 Hz for quick starting
     wake_up();
@@ -3582,23 +3616,38 @@ int32_t Stepper::triggered_position(const AxisEnum axis) {
   #define SAYS_C 1
 #endif
 
-void Stepper::report_a_position(const xyz_long_t &pos) {
+void Stepper::add_a_position(ReportBuffer &rb, const xyz_long_t &pos) {
   #if NUM_AXES
-    SERIAL_ECHOLNPGM_P(NUM_AXIS_PAIRED_LIST(
-      TERN(SAYS_A, PSTR(STR_COUNT_A), PSTR(STR_COUNT_X)), pos.x,
-      TERN(SAYS_B, PSTR("B:"), SP_Y_LBL), pos.y,
-      TERN(SAYS_C, PSTR("C:"), SP_Z_LBL), pos.z,
-      SP_I_LBL, pos.i, SP_J_LBL, pos.j, SP_K_LBL, pos.k,
-      SP_U_LBL, pos.u, SP_V_LBL, pos.v, SP_W_LBL, pos.w
-    ));
+    static ReportTemplate tpl(PSTR(NUM_AXIS_GANG(
+      TERN(SAYS_A, STR_COUNT_A, STR_COUNT_X) "%",
+      TERN(SAYS_B, "B:", " Y:") "%",
+      TERN(SAYS_C, "C:", " Z:") "%",
+      " " STR_I ":%", " " STR_J ":%", " " STR_K ":%",
+      " " STR_U ":%", " " STR_V ":%", " " STR_W ":%"
+    ) "\n"));
+    rb.fill(tpl, NUM_AXIS_LIST(pos.x, pos.y, pos.z, pos.i, pos.j, pos.k, pos.u, pos.v, pos.w));
+  #else
+    rb.eol();
   #endif
 }
 
-void Stepper::report_positions() {
+void Stepper::add_positions(ReportBuffer &rb) {
   AVR_ATOMIC_SECTION_START();
   const xyz_long_t pos = count_position;
   AVR_ATOMIC_SECTION_END();
-  report_a_position(pos);
+  add_a_position(rb, pos);
+}
+
+void Stepper::report_a_position(const xyz_long_t &pos) {
+  ReportBuffer rb;
+  add_a_position(rb, pos);
+  rb.send();
+}
+
+void Stepper::report_positions() {
+  ReportBuffer rb;
+  add_positions(rb);
+  rb.send();
 }
 
 #if ENABLED(FT_MOTION)
@@ -318,6 +318,8 @@ constexpr ena_mask_t enable_overlap[] = {
 
 #endif // NONLINEAR_EXTRUSION
 
+class ReportBuffer;
+
 //
 // Stepper class definition
 //
@@ -614,6 +616,8 @@ class Stepper {
     #endif
 
     // Report the positions of the steppers, in steps
+    static void add_a_position(ReportBuffer &rb, const xyz_long_t &pos);
+    static void add_positions(ReportBuffer &rb);
     static void report_a_position(const xyz_long_t &pos);
     static void report_positions();
 
@@ -73,6 +73,22 @@
   #include "trinamic.h"
 #endif
 
+// Single-stepper axes that may get hardware STEP pulses (See HAL_step_pulse_attach)
+#if ENABLED(STEP_TIMER_PULSE)
+  #if HAS_X_AXIS && !HAS_X2_STEPPER && !AXIS_HAS_DEDGE(X)
+    #define X_STEP_TIMER 1
+  #endif
+  #if HAS_Y_AXIS && !HAS_Y2_STEPPER && !AXIS_HAS_DEDGE(Y)
+    #define Y_STEP_TIMER 1
+  #endif
+  #if HAS_Z_AXIS && NUM_Z_STEPPERS == 1 && !AXIS_HAS_DEDGE(Z)
+    #define Z_STEP_TIMER 1
+  #endif
+  #if HAS_EXTRUDERS && E_STEPPERS == 1 && DISABLED(MIXING_EXTRUDER) && !AXIS_HAS_DEDGE(E0)
+    #define E0_STEP_TIMER 1
+  #endif
+#endif
+
 void restore_stepper_drivers();  // Called by powerManager.power_on()
 void reset_stepper_drivers();    // Called by settings.load / settings.reset
 
@@ -95,7 +111,11 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #define X_STEP_INIT() SET_OUTPUT(X_STEP_PIN)
   #ifndef X_STEP_WRITE
-    #define X_STEP_WRITE(STATE) WRITE(X_STEP_PIN,STATE)
+    #if X_STEP_TIMER
+      #define X_STEP_WRITE(STATE) HAL_STEP_PULSE_WRITE(X_AXIS, X_STEP_PIN, STATE, STEP_STATE_X)
+    #else
+      #define X_STEP_WRITE(STATE) WRITE(X_STEP_PIN,STATE)
+    #endif
   #endif
   #define X_STEP_READ() bool(READ(X_STEP_PIN))
 #endif
@@ -117,7 +137,11 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #define Y_STEP_INIT() SET_OUTPUT(Y_STEP_PIN)
   #ifndef Y_STEP_WRITE
-    #define Y_STEP_WRITE(STATE) WRITE(Y_STEP_PIN,STATE)
+    #if Y_STEP_TIMER
+      #define Y_STEP_WRITE(STATE) HAL_STEP_PULSE_WRITE(Y_AXIS, Y_STEP_PIN, STATE, STEP_STATE_Y)
+    #else
+      #define Y_STEP_WRITE(STATE) WRITE(Y_STEP_PIN,STATE)
+    #endif
   #endif
   #define Y_STEP_READ() bool(READ(Y_STEP_PIN))
 #endif
@@ -139,7 +163,11 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #define Z_STEP_INIT() SET_OUTPUT(Z_STEP_PIN)
   #ifndef Z_STEP_WRITE
-    #define Z_STEP_WRITE(STATE) WRITE(Z_STEP_PIN,STATE)
+    #if Z_STEP_TIMER
+      #define Z_STEP_WRITE(STATE) HAL_STEP_PULSE_WRITE(Z_AXIS, Z_STEP_PIN, STATE, STEP_STATE_Z)
+    #else
+      #define Z_STEP_WRITE(STATE) WRITE(Z_STEP_PIN,STATE)
+    #endif
   #endif
   #define Z_STEP_READ() bool(READ(Z_STEP_PIN))
 #endif
@@ -414,7 +442,11 @@ void reset_stepper_drivers();    // Called by settings.load / settings.reset
   #endif
   #define E0_STEP_INIT() SET_OUTPUT(E0_STEP_PIN)
   #ifndef E0_STEP_WRITE
-    #define E0_STEP_WRITE(STATE) WRITE(E0_STEP_PIN,STATE)
+    #if E0_STEP_TIMER
+      #define E0_STEP_WRITE(STATE) HAL_STEP_PULSE_WRITE(E_AXIS, E0_STEP_PIN, STATE, STEP_STATE_E)
+    #else
+      #define E0_STEP_WRITE(STATE) WRITE(E0_STEP_PIN,STATE)
+    #endif
   #endif
   #define E0_STEP_READ() bool(READ(E0_STEP_PIN))
 #endif
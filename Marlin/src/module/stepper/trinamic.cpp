@@ -948,7 +948,9 @@ enum StealthIndex : uint8_t {
     TERN_(EDGE_STEPPING, st.dedge(true));
     st.intpol(interpolate);
     st.diss2g(true); // Disable short to ground protection. Too many false readings?
-    TERN_(TMC_DEBUG, st.rdsel(0b01));
+    #if ANY(TMC_DEBUG, AUTO_REPORT_TMC_LOAD)
+      st.rdsel(0b01); // DRVSTATUS reports SG_RESULT
+    #endif
   }
 #endif // TMC2660
 
@@ -36,6 +36,7 @@
 #include "endstops.h"
 #include "planner.h"
 #include "printcounter.h"
+#include "../core/report_buffer.h"
 
 #if ANY(HAS_COOLER, LASER_COOLANT_FLOW_METER)
   #include "../feature/cooler.h"
@@ -4463,7 +4464,7 @@ void Temperature::isr() {
 
 #if HAS_TEMP_SENSOR
   /**
-   * Print a single heater state in the form:
+   * Add a single heater state to a report in the form:
    *     Extruder: " T0:nnn.nn /nnn.nn"
    *          Bed: " B:nnn.nn /nnn.nn"
    *      Chamber: " C:nnn.nn /nnn.nn"
@@ -4474,7 +4475,7 @@ void Temperature::isr() {
    *    Redundant: " R:nnn.nn /nnn.nn"
    *     With ADC: " T0:nnn.nn /nnn.nn (nnn.nn)"
    */
-  static void print_heater_state(const heater_id_t e, const celsius_float_t c, const celsius_float_t t
+  static void add_heater_state(ReportBuffer &rb, const heater_id_t e, const celsius_float_t c, const celsius_float_t t
     OPTARG(SHOW_TEMP_ADC_VALUES, const float r)
   ) {
     char k;
@@ -4510,21 +4511,19 @@ void Temperature::isr() {
       #define HEATER_STATE_FLOAT_PRECISION _MIN(SERIAL_FLOAT_PRECISION, 2)
     #endif
 
-    SString<50> s(' ', k);
-    if (TERN0(HAS_MULTI_HOTEND, e >= 0)) s += char('0' + e);
-    s += ':'; s += p_float_t(c, HEATER_STATE_FLOAT_PRECISION);
-    if (show_t) { s += F(" /"); s += p_float_t(t, HEATER_STATE_FLOAT_PRECISION); }
+    rb.add(' ', k);
+    if (TERN0(HAS_MULTI_HOTEND, e >= 0)) rb.add(char('0' + e));
+    rb.add(':', p_float_t(c, HEATER_STATE_FLOAT_PRECISION));
+    if (show_t) rb.add(F(" /"), p_float_t(t, HEATER_STATE_FLOAT_PRECISION));
     #if ENABLED(SHOW_TEMP_ADC_VALUES)
       // Temperature MAX SPI boards do not have an OVERSAMPLENR defined
-      s.append(F(" ("), TERN(HAS_MAXTC_LIBRARIES, k == 'T', false) ? r : r * RECIPROCAL(OVERSAMPLENR), ')');
+      rb.add(F(" ("), TERN(HAS_MAXTC_LIBRARIES, k == 'T', false) ? r : r * RECIPROCAL(OVERSAMPLENR), ')');
     #endif
-    s.echo();
-    delay(2);
   }
 
   /**
-   * Print all heater states followed by power data on a single line.
-   * See print_heater_state for heater output strings.
+   * Add all heater states followed by power data on a single line.
+   * See add_heater_state for heater output strings.
    * Power output strings are in the format:
    *     Extruder: " @:nnn"
    *          Bed: " B@:nnn"
@@ -4533,53 +4532,62 @@ void Temperature::isr() {
    *       Cooler: " L@:nnn"
    *      Hotends: " @0:nnn @1:nnn ..."
    */
-  void Temperature::print_heater_states(const int8_t target_extruder
+  void Temperature::add_heater_states(ReportBuffer &rb, const int8_t target_extruder
     OPTARG(HAS_TEMP_REDUNDANT, const bool include_r/*=false*/)
   ) {
     #if HAS_TEMP_HOTEND
-      print_heater_state(H_NONE, degHotend(target_extruder), degTargetHotend(target_extruder) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(target_extruder)));
+      add_heater_state(rb, H_NONE, degHotend(target_extruder), degTargetHotend(target_extruder) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(target_extruder)));
     #endif
     #if HAS_HEATED_BED
-      print_heater_state(H_BED, degBed(), degTargetBed() OPTARG(SHOW_TEMP_ADC_VALUES, rawBedTemp()));
+      add_heater_state(rb, H_BED, degBed(), degTargetBed() OPTARG(SHOW_TEMP_ADC_VALUES, rawBedTemp()));
     #endif
     #if HAS_TEMP_CHAMBER
-      print_heater_state(H_CHAMBER, degChamber(), TERN0(HAS_HEATED_CHAMBER, degTargetChamber()) OPTARG(SHOW_TEMP_ADC_VALUES, rawChamberTemp()));
+      add_heater_state(rb, H_CHAMBER, degChamber(), TERN0(HAS_HEATED_CHAMBER, degTargetChamber()) OPTARG(SHOW_TEMP_ADC_VALUES, rawChamberTemp()));
     #endif
     #if HAS_TEMP_COOLER
-      print_heater_state(H_COOLER, degCooler(), TERN0(HAS_COOLER, degTargetCooler()) OPTARG(SHOW_TEMP_ADC_VALUES, rawCoolerTemp()));
+      add_heater_state(rb, H_COOLER, degCooler(), TERN0(HAS_COOLER, degTargetCooler()) OPTARG(SHOW_TEMP_ADC_VALUES, rawCoolerTemp()));
     #endif
     #if HAS_TEMP_PROBE
-      print_heater_state(H_PROBE, degProbe(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawProbeTemp()));
+      add_heater_state(rb, H_PROBE, degProbe(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawProbeTemp()));
     #endif
     #if HAS_TEMP_BOARD
-      print_heater_state(H_BOARD, degBoard(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawBoardTemp()));
+      add_heater_state(rb, H_BOARD, degBoard(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawBoardTemp()));
     #endif
     #if HAS_TEMP_SOC
-      print_heater_state(H_SOC, degSoc(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawSocTemp()));
+      add_heater_state(rb, H_SOC, degSoc(), 0 OPTARG(SHOW_TEMP_ADC_VALUES, rawSocTemp()));
     #endif
     #if HAS_TEMP_REDUNDANT
-      if (include_r) print_heater_state(H_REDUNDANT, degRedundant(), degRedundantTarget() OPTARG(SHOW_TEMP_ADC_VALUES, rawRedundantTemp()));
+      if (include_r) add_heater_state(rb, H_REDUNDANT, degRedundant(), degRedundantTarget() OPTARG(SHOW_TEMP_ADC_VALUES, rawRedundantTemp()));
     #endif
     #if HAS_MULTI_HOTEND
-      HOTEND_LOOP() print_heater_state((heater_id_t)e, degHotend(e), degTargetHotend(e) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(e)));
+      HOTEND_LOOP() add_heater_state(rb, (heater_id_t)e, degHotend(e), degTargetHotend(e) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(e)));
     #endif
-    SString<100> s(F(" @:"), getHeaterPower((heater_id_t)target_extruder));
-    TERN_(HAS_HEATED_BED,     s.append(F(" B@:"), getHeaterPower(H_BED)));
-    TERN_(PELTIER_BED,        s.append(F(" P@:"), temp_bed.peltier_dir_heating ? 'H' : 'C'));
-    TERN_(HAS_HEATED_CHAMBER, s.append(F(" C@:"), getHeaterPower(H_CHAMBER)));
-    TERN_(HAS_COOLER,         s.append(F(" L@:"), getHeaterPower(H_COOLER)));
+    rb.add(F(" @:"), getHeaterPower((heater_id_t)target_extruder));
+    TERN_(HAS_HEATED_BED,     rb.add(F(" B@:"), getHeaterPower(H_BED)));
+    TERN_(PELTIER_BED,        rb.add(F(" P@:"), temp_bed.peltier_dir_heating ? 'H' : 'C'));
+    TERN_(HAS_HEATED_CHAMBER, rb.add(F(" C@:"), getHeaterPower(H_CHAMBER)));
+    TERN_(HAS_COOLER,         rb.add(F(" L@:"), getHeaterPower(H_COOLER)));
     #if HAS_MULTI_HOTEND
-      HOTEND_LOOP() s.append(F(" @"), e, ':', getHeaterPower((heater_id_t)e));
+      HOTEND_LOOP() rb.add(F(" @"), e, ':', getHeaterPower((heater_id_t)e));
     #endif
-    s.echo();
+  }
+
+  // Print all heater states with a single serial write
+  void Temperature::print_heater_states(const int8_t target_extruder
+    OPTARG(HAS_TEMP_REDUNDANT, const bool include_r/*=false*/)
+  ) {
+    ReportBuffer rb;
+    add_heater_states(rb, target_extruder OPTARG(HAS_TEMP_REDUNDANT, include_r));
+    rb.send();
   }
 
   #if ENABLED(AUTO_REPORT_TEMPERATURES)
     AutoReporter<Temperature::AutoReportTemp> Temperature::auto_reporter;
     void Temperature::AutoReportTemp::report() {
       if (marlin.is_heating()) return;
-      print_heater_states(active_extruder OPTARG(HAS_TEMP_REDUNDANT, ENABLED(AUTO_REPORT_REDUNDANT)));
-      SERIAL_EOL();
+      ReportBuffer rb;
+      add_heater_states(rb, active_extruder OPTARG(HAS_TEMP_REDUNDANT, ENABLED(AUTO_REPORT_REDUNDANT)));
+      rb.eol().send();
     }
   #endif
 
@@ -642,6 +642,8 @@ typedef struct { raw_adc_t raw_min, raw_max; } temp_raw_range_t;
 
 #endif // AUTOTEMP
 
+class ReportBuffer;
+
 class Temperature {
 
   public:
@@ -1378,6 +1380,9 @@ class Temperature {
     #endif // HEATER_IDLE_HANDLER
 
     #if HAS_TEMP_SENSOR
+      static void add_heater_states(ReportBuffer &rb, const int8_t target_extruder
+        OPTARG(HAS_TEMP_REDUNDANT, const bool include_r=false)
+      );
       static void print_heater_states(const int8_t target_extruder
         OPTARG(HAS_TEMP_REDUNDANT, const bool include_r=false)
       );
@@ -46,6 +46,7 @@
 #include "../gcode/queue.h"
 #include "../module/settings.h"
 #include "../module/stepper/indirection.h"
+#include "../core/report_buffer.h"
 
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
@@ -59,6 +60,14 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(SD_TIME_ESTIMATE)
+  #include "../feature/time_estimate.h"
+#endif
+
+#if ALL(DWIN_LCD_PROUI, MEDIA_FILE_INDEX)
+  #include "../lcd/dwin/proui/file_index.h"
+#endif
+
 #if ENABLED(ONE_CLICK_PRINT) && DISABLED(DWIN_LCD_PROUI)
   #include "../../src/lcd/menu/menu.h"
 #endif
@@ -301,6 +310,10 @@ void CardReader::printListing(MediaFile parent, const char * const prepend, cons
   #if ENABLED(CUSTOM_FIRMWARE_UPLOAD)
     const bool binFiles = TEST(lsflags, LS_ONLY_BIN);
   #endif
+  #if ALL(DWIN_LCD_PROUI, MEDIA_FILE_INDEX)
+    MediaFile index;
+    if (TEST(lsflags, LS_FILE_INDEX)) FileIndex::open(index, parent);
+  #endif
   UNUSED(lsflags);
   dir_t p;
   while (parent.readDir(&p, longFilename) > 0) {
@@ -347,6 +360,9 @@ void CardReader::printListing(MediaFile parent, const char * const prepend, cons
         SERIAL_ECHOPGM(" 0x", hex_word(crmodDate));
         print_hex_word(crmodTime);
       }
+      #if ALL(DWIN_LCD_PROUI, MEDIA_FILE_INDEX)
+        FileIndex::report(index, p);
+      #endif
       #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
         if (includeLong) {
           SERIAL_CHAR(' ');
@@ -729,6 +745,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(DWIN_CREALITY_LCD, hmiFlag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) myfile.close();
+  TERN_(SD_TIME_ESTIMATE, TimeEstimate::reset());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -848,6 +865,10 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     filesize = myfile.fileSize();
     sdpos = 0;
 
+    #if PROUI_EX
+      if (subcall_type == 100) return; // Header reads are quiet and keep the selection
+    #endif
+
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
       SERIAL_ECHOLNPGM(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -959,8 +980,10 @@ void CardReader::report_status(TERN_(QUIETER_AUTO_REPORT_SD_STATUS, const bool i
     if (has_job) old_sdpos = sdpos;
   #endif
 
-  if (has_job)
-    SERIAL_ECHOLN(F(STR_SD_PRINTING_BYTE), sdpos, C('/'), filesize);
+  if (has_job) {
+    static ReportTemplate tpl(PSTR(STR_SD_PRINTING_BYTE "%/%\n"));
+    ReportBuffer().fill(tpl, sdpos, filesize).send();
+  }
   else
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
 }
@@ -1309,7 +1332,10 @@ void CardReader::cdroot() {
   flag.workDirIsRoot = true;
   workDirDepth = 0;
   nrItems = -1;
-  TERN_(SDCARD_SORT_ALPHA, presort());
+  #if ENABLED(SDCARD_SORT_ALPHA)
+    // With FAST_BOOT the first sort is done after setup()
+    if (TERN1(FAST_BOOT, !marlin.is(MF_INITIALIZING))) presort();
+  #endif
 }
 
 #if ENABLED(SDCARD_SORT_ALPHA)
@@ -1684,10 +1710,23 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    // The journal is preallocated by createJobRecoveryFile and written in place
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_WRITE))
       openFailed(recovery.filename);
-    else if (!read)
-      echo_write_to_file(recovery.filename);
+  }
+
+  // Replace the job recovery file with a new one of the given size,
+  // allocated as a single run of clusters. Leave it open for writing.
+  bool CardReader::createJobRecoveryFile(const uint32_t size) {
+    if (!isMounted()) return false;
+    if (recovery.file.isOpen()) recovery.file.close();
+    if (jobRecoverFileExists()) MediaFile::remove(&root, recovery.filename);
+    if (!recovery.file.createContiguous(&root, recovery.filename, size)) {
+      openFailed(recovery.filename);
+      return false;
+    }
+    echo_write_to_file(recovery.filename);
+    return true;
   }
 
   // Removing the job recovery file currently requires closing
@@ -90,7 +90,7 @@ enum MediaPresence : int8_t {
   INSERT_USB    = TERN(HAS_MULTI_VOLUME, 0x04, 0x00)
 };
 
-enum ListingFlags : uint8_t { LS_LONG_FILENAME, LS_ONLY_BIN, LS_TIMESTAMP };
+enum ListingFlags : uint8_t { LS_LONG_FILENAME, LS_ONLY_BIN, LS_TIMESTAMP, LS_FILE_INDEX };
 enum SortFlag : int8_t { AS_REV = -1, AS_OFF, AS_FWD, AS_ALSO_REV };
 
 #if ENABLED(AUTO_REPORT_SD_STATUS)
@@ -218,6 +218,9 @@ public:
   // The root directory of the current mounted drive
   static MediaFile getroot() { return root; }
 
+  // A handle on the open file, to read it apart from the print
+  static MediaFile getFile() { return myfile; }
+
   // Basic file ops
   static void openFileRead(const char * const path, const uint8_t subcall=0);
   static void openFileWrite(const char * const path);
@@ -300,6 +303,7 @@ public:
   #if ENABLED(POWER_LOSS_RECOVERY)
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
+    static bool createJobRecoveryFile(const uint32_t size);
     static void removeJobRecoveryFile();
   #endif
 
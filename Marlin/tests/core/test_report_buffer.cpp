@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include "src/core/report_buffer.h"
+
+static const char* ftoa_str(const float v, const uint8_t prec) {
+  static char out[24];
+  out[report_ftoa(out, v, prec)] = '\0';
+  return out;
+}
+
+MARLIN_TEST(report_buffer, ftoa_rounding) {
+  TEST_ASSERT_EQUAL_STRING("0.00", ftoa_str(0.0f, 2));
+  TEST_ASSERT_EQUAL_STRING("1.50", ftoa_str(1.5f, 2));
+  TEST_ASSERT_EQUAL_STRING("210.00", ftoa_str(209.996f, 2));
+  TEST_ASSERT_EQUAL_STRING("0.100", ftoa_str(0.1f, 3));
+  TEST_ASSERT_EQUAL_STRING("12", ftoa_str(12.4f, 0));
+}
+
+MARLIN_TEST(report_buffer, ftoa_negative) {
+  TEST_ASSERT_EQUAL_STRING("-3.25", ftoa_str(-3.25f, 2));
+  TEST_ASSERT_EQUAL_STRING("-0.00", ftoa_str(-0.001f, 2));
+}
+
+MARLIN_TEST(report_buffer, ftoa_large_values) {
+  // Scaling the whole value in float would round these up
+  TEST_ASSERT_EQUAL_STRING("-337.794", ftoa_str(-337.794495f, 3));
+  TEST_ASSERT_EQUAL_STRING("-197.66", ftoa_str(-197.664993f, 2));
+  TEST_ASSERT_EQUAL_STRING("1000.00", ftoa_str(999.999f, 2));
+}
+
+MARLIN_TEST(report_buffer, add_values) {
+  ReportBuffer rb;
+  rb.add(F(" T:"), p_float_t(21.5f, 2), F(" /"), 0, ' ', int8_t(-7), ' ', uint32_t(4000000000UL));
+  TEST_ASSERT_EQUAL_STRING(" T:21.50 /0 -7 4000000000", rb.str());
+  rb.clear();
+  TEST_ASSERT_EQUAL(0, rb.length());
+}
+
+MARLIN_TEST(report_buffer, template_fill) {
+  static ReportTemplate tpl(PSTR("X:% Y:% Count X:%\n"));
+  ReportBuffer rb;
+  rb.fill(tpl, p_float_t(1.0f, 2), p_float_t(-2.5f, 2), int32_t(-400));
+  TEST_ASSERT_EQUAL(3, tpl.fields);
+  TEST_ASSERT_EQUAL_STRING("X:1.00 Y:-2.50 Count X:-400\n", rb.str());
+
+  // A template is indexed once and reused
+  rb.clear().fill(tpl, p_float_t(0.0f, 2), p_float_t(0.0f, 2), int32_t(0));
+  TEST_ASSERT_EQUAL_STRING("X:0.00 Y:0.00 Count X:0\n", rb.str());
+}
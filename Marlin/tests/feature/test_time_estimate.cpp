@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(SD_TIME_ESTIMATE)
+
+#include "src/feature/time_estimate.h"
+#include "src/module/planner.h"
+
+// Generous limits, so only the M204 acceleration and the feedrate matter
+static void set_limits() {
+  LOOP_DISTINCT_AXES(i) {
+    planner.settings.max_feedrate_mm_s[i] = 1000;
+    planner.settings.max_acceleration_mm_per_s2[i] = 100000;
+  }
+  planner.settings.min_feedrate_mm_s = 0;
+  planner.settings.acceleration = planner.settings.travel_acceleration = planner.settings.retract_acceleration = 1000;
+}
+
+// Simulate the lines of a file, one byte per character and end of line
+static float simulate(const char * const lines[], const uint8_t count) {
+  uint32_t size = 0;
+  for (uint8_t i = 0; i < count; ++i) size += strlen(lines[i]) + 1;
+
+  TimeEstimate::begin(size);
+  uint32_t pos = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    char cmd[MAX_CMD_SIZE];
+    strcpy(cmd, lines[i]);
+    pos += strlen(cmd) + 1;
+    TimeEstimate::line(cmd, pos);
+  }
+  TimeEstimate::finish();
+  return TimeEstimate::total();
+}
+
+MARLIN_TEST(time_estimate, trapezoid_reaches_nominal_speed) {
+  set_limits();
+  // 100mm at 100mm/s and 1000mm/s^2: 0.1s up, 0.9s cruise, 0.1s down
+  const char * const lines[] = { "G1 X100 F6000" };
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.1f, simulate(lines, COUNT(lines)));
+}
+
+MARLIN_TEST(time_estimate, triangle_below_nominal_speed) {
+  set_limits();
+  // 2mm at 1000mm/s^2 peaks at sqrt(2000)mm/s, well below 100mm/s
+  const char * const lines[] = { "G1 X2 F6000" };
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 2.0f * SQRT(2000.0f) / 1000.0f, simulate(lines, COUNT(lines)));
+}
+
+MARLIN_TEST(time_estimate, dwell_and_m204) {
+  set_limits();
+  // M204 T500 makes the travel 0.2s up, 0.8s cruise, 0.2s down. G4 adds 0.5s.
+  const char * const lines[] = { "M204 T500", "G0 X100 F6000 ; travel", "G4 P500" };
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.7f, simulate(lines, COUNT(lines)));
+}
+
+MARLIN_TEST(time_estimate, remaining_follows_file_position) {
+  set_limits();
+  const char * const lines[] = { "G1 X100 F6000", "G1 X0" };
+  const float total = simulate(lines, COUNT(lines));
+  TEST_ASSERT_FLOAT_WITHIN(0.002f, 2.2f, total);
+
+  // Nothing is printed at the start, and nothing is left at the end
+  const uint32_t size = (strlen(lines[0]) + 1) + (strlen(lines[1]) + 1);
+  TEST_ASSERT_EQUAL(LROUND(total), TimeEstimate::remaining(0));
+  TEST_ASSERT_EQUAL(0, TimeEstimate::remaining(size));
+
+  // A reset forgets the estimate
+  TimeEstimate::reset();
+  TEST_ASSERT_EQUAL(0, TimeEstimate::remaining(0));
+}
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ALL(AUTO_BED_LEVELING_UBL, OPTIMIZED_MESH_STORAGE) && !PROUI_EX
+
+#include "src/feature/bedlevel/bedlevel.h"
+
+MARLIN_TEST(ubl_mesh_store, round_trip_within_half_quantum) {
+  bed_mesh_t in, out;
+  // A tilted bed with a few tenths of a millimeter of warp and one unprobed point
+  GRID_LOOP(x, y) in[x][y] = 0.2f + 0.04f * x - 0.03f * y + 0.05f * ((x * 7 + y * 13) % 5) - 0.001f * x * y;
+  in[1][0] = NAN;
+
+  mesh_store_t store;
+  bedlevel.set_store_from_mesh(in, store);
+  TEST_ASSERT_TRUE(bedlevel.set_mesh_from_store(store, out));
+
+  const float tolerance = store.quantum * 0.0005f + 0.00001f;
+  GRID_LOOP(x, y) {
+    if (isnan(in[x][y]))
+      TEST_ASSERT_TRUE(isnan(out[x][y]));
+    else
+      TEST_ASSERT_FLOAT_WITHIN(tolerance, in[x][y], out[x][y]);
+  }
+}
+
+MARLIN_TEST(ubl_mesh_store, corrupt_slot_is_rejected) {
+  bed_mesh_t in, out;
+  GRID_LOOP(x, y) in[x][y] = 0.01f * x - 0.02f * y;
+
+  mesh_store_t store;
+  bedlevel.set_store_from_mesh(in, store);
+  store.residual[0][0] ^= 1;
+  TEST_ASSERT_FALSE(bedlevel.set_mesh_from_store(store, out));
+  TEST_ASSERT_TRUE(isnan(out[0][0]));
+}
+
+MARLIN_TEST(ubl_mesh_store, blank_legacy_slot_is_rejected) {
+  mesh_store_legacy_t legacy;
+  bed_mesh_t out;
+  GRID_LOOP(x, y) legacy[x][y] = -1; // Erased EEPROM
+  TEST_ASSERT_FALSE(bedlevel.set_mesh_from_legacy_store(legacy, out));
+  legacy[0][0] = 120;
+  TEST_ASSERT_TRUE(bedlevel.set_mesh_from_legacy_store(legacy, out));
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.12f, out[0][0]);
+}
+
+#endif
@@ -0,0 +1,177 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(AUTO_BED_LEVELING_UBL) && !UBL_SEGMENTED
+
+#include "src/feature/bedlevel/bedlevel.h"
+
+#define MAX_TEST_SEGMENTS 512
+
+static xyze_pos_t segments[MAX_TEST_SEGMENTS];
+static uint16_t segment_count;
+
+static bool record_segment(const xyze_pos_t &target) {
+  if (segment_count >= MAX_TEST_SEGMENTS) return false;
+  segments[segment_count++] = target;
+  return true;
+}
+
+// A bumpy, twisted mesh so every cell has a non-zero zxy term
+static void fill_test_mesh() {
+  GRID_LOOP(x, y) bedlevel.z_values[x][y] = 0.05f * ((x * 7 + y * 13) % 5) - 0.1f + 0.01f * x * y;
+}
+
+static xyze_pos_t mesh_pos(const float fx, const float fy) {
+  xyze_pos_t pos{0};
+  pos.x = bedlevel.get_mesh_x(0) + fx * (bedlevel.get_mesh_x(GRID_MAX_POINTS_X - 1) - bedlevel.get_mesh_x(0));
+  pos.y = bedlevel.get_mesh_y(0) + fy * (bedlevel.get_mesh_y(GRID_MAX_POINTS_Y - 1) - bedlevel.get_mesh_y(0));
+  return pos;
+}
+
+// Walk a move with Z=0 so each segment Z is the applied correction
+static void walk(const xyze_pos_t &start, const xyze_pos_t &end, const float fade_factor=1.0f) {
+  segment_count = 0;
+  TEST_ASSERT_TRUE(bedlevel.walk_mesh_cells(start, end, fade_factor, record_segment));
+  TEST_ASSERT_TRUE(segment_count > 0);
+}
+
+/**
+ * Z correction of a point of the move as the previous segmentation applied it.
+ * It placed points only on the interior mesh lines and at the end of the move.
+ * Return NAN for any other point, and for mesh line points off the mesh, where
+ * it extrapolated the edge cells even with UBL_Z_RAISE_WHEN_OFF_MESH.
+ */
+static float previous_z(const xy_pos_t &pos, const bool at_end, const float fade_factor) {
+  if (at_end) {
+    #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+      if (!bedlevel.cell_index_x_valid(pos.x) || !bedlevel.cell_index_y_valid(pos.y))
+        return UBL_Z_RAISE_WHEN_OFF_MESH;
+    #endif
+    const xy_uint8_t c = bedlevel.cell_indexes(pos);
+    const float xratio = (pos.x - bedlevel.get_mesh_x(c.x)) * RECIPROCAL(MESH_X_DIST),
+                yratio = (pos.y - bedlevel.get_mesh_y(c.y)) * RECIPROCAL(MESH_Y_DIST),
+                z1 = bedlevel.z_values[c.x][c.y    ] + xratio * (bedlevel.z_values[c.x + 1][c.y    ] - bedlevel.z_values[c.x][c.y    ]),
+                z2 = bedlevel.z_values[c.x][c.y + 1] + xratio * (bedlevel.z_values[c.x + 1][c.y + 1] - bedlevel.z_values[c.x][c.y + 1]);
+    return (z1 + (z2 - z1) * yratio) * fade_factor;
+  }
+
+  if (!WITHIN(pos.x, MESH_MIN_X, MESH_MAX_X) || !WITHIN(pos.y, MESH_MIN_Y, MESH_MAX_Y)) return NAN;
+
+  for (uint8_t i = 1; i < (GRID_MAX_POINTS_X) - 1; ++i)
+    if (ABS(pos.x - bedlevel.get_mesh_x(i)) < 0.0001f)
+      return bedlevel.z_correction_for_y_on_vertical_mesh_line(pos.y, i, bedlevel.cell_index_y(pos.y)) * fade_factor;
+  for (uint8_t i = 1; i < (GRID_MAX_POINTS_Y) - 1; ++i)
+    if (ABS(pos.y - bedlevel.get_mesh_y(i)) < 0.0001f)
+      return bedlevel.z_correction_for_x_on_horizontal_mesh_line(pos.x, bedlevel.cell_index_x(pos.x), i) * fade_factor;
+
+  return NAN;
+}
+
+static const float test_moves[][4] = {
+  { 0.10f, 0.10f, 0.90f, 0.85f },   // Diagonal across many cells
+  { 0.95f, 0.80f, 0.05f, 0.15f },   // Diagonal, backward
+  { 0.00f, 0.00f, 1.00f, 1.00f },   // Through mesh points
+  { 0.25f, 0.50f, 0.25f, 0.00f },   // Vertical, starting on a mesh line
+  { 0.33f, 0.02f, 0.41f, 0.03f },   // Short move within one cell
+  { -0.10f, 0.40f, 1.10f, 0.60f }   // Off the mesh at both ends
+};
+
+MARLIN_TEST(ubl_motion, segments_match_previous_segmentation) {
+  fill_test_mesh();
+  static const float moves[][4] = {
+    { 0.10f, 0.10f, 0.90f, 0.85f },   // Diagonal across many cells
+    { 0.95f, 0.80f, 0.05f, 0.15f },   // Diagonal, backward
+    { 0.25f, 0.50f, 0.25f, 0.03f },   // Vertical
+    { -0.10f, 0.40f, 1.10f, 0.60f },  // Off the mesh at both ends
+    { 1.15f, 0.35f, 0.45f, 0.55f },   // From off the mesh onto it
+    { 0.55f, 0.45f, 0.60f, -0.20f },  // Ending off the front of the mesh
+    { 0.30f, -0.15f, 0.70f, -0.10f }  // Entirely off the mesh
+  };
+  for (const float fade_factor : { 1.0f, 0.4f }) {
+    for (const auto &m : moves) {
+      const xyze_pos_t start = mesh_pos(m[0], m[1]), end = mesh_pos(m[2], m[3]);
+      walk(start, end, fade_factor);
+      // The end point is always compared. Off the mesh its raise isn't faded.
+      for (uint16_t i = 0; i < segment_count; ++i) {
+        const float z = previous_z(segments[i], i == segment_count - 1, fade_factor);
+        if (!isnan(z)) TEST_ASSERT_FLOAT_WITHIN(0.0001f, z, segments[i].z);
+      }
+    }
+  }
+}
+
+#ifndef UBL_Z_RAISE_WHEN_OFF_MESH
+
+MARLIN_TEST(ubl_motion, segments_match_get_z_correction) {
+  fill_test_mesh();
+  for (const auto &m : test_moves) {
+    const xyze_pos_t start = mesh_pos(m[0], m[1]), end = mesh_pos(m[2], m[3]);
+    walk(start, end);
+    for (uint16_t i = 0; i < segment_count; ++i)
+      TEST_ASSERT_FLOAT_WITHIN(0.0001f, bedlevel.get_z_correction(segments[i]), segments[i].z);
+
+    const xyze_pos_t &last = segments[segment_count - 1];
+    TEST_ASSERT_EQUAL_FLOAT(end.x, last.x);
+    TEST_ASSERT_EQUAL_FLOAT(end.y, last.y);
+  }
+}
+
+MARLIN_TEST(ubl_motion, chords_stay_within_tolerance) {
+  fill_test_mesh();
+  for (const auto &m : test_moves) {
+    xyze_pos_t prev = mesh_pos(m[0], m[1]);
+    walk(prev, mesh_pos(m[2], m[3]));
+    prev.z = bedlevel.get_z_correction(prev);
+    for (uint16_t i = 0; i < segment_count; ++i) {
+      // Compare the middle of each chord to the mesh surface, where the error peaks
+      const xy_pos_t mid = (xy_pos_t(prev) + xy_pos_t(segments[i])) * 0.5f;
+      const float chord_z = (prev.z + segments[i].z) * 0.5f;
+      TEST_ASSERT_FLOAT_WITHIN(float(UBL_SEGMENT_TOLERANCE) + 0.0001f, bedlevel.get_z_correction(mid), chord_z);
+      prev = segments[i];
+    }
+  }
+}
+
+MARLIN_TEST(ubl_motion, one_segment_per_cell_when_axis_aligned) {
+  fill_test_mesh();
+  // From the middle of the first cell to the middle of the last cell in one row
+  const float half_x = 0.5f / (GRID_MAX_POINTS_X - 1), half_y = 0.5f / (GRID_MAX_POINTS_Y - 1);
+  walk(mesh_pos(half_x, half_y), mesh_pos(1.0f - half_x, half_y));
+  TEST_ASSERT_EQUAL(GRID_MAX_POINTS_X - 1, segment_count);
+}
+
+MARLIN_TEST(ubl_motion, flat_mesh_needs_no_split) {
+  GRID_LOOP(x, y) bedlevel.z_values[x][y] = 0.1f + 0.02f * x - 0.03f * y; // A tilted plane
+  const xyze_pos_t start = mesh_pos(0.05f, 0.12f), end = mesh_pos(0.95f, 0.9f);
+  walk(start, end);
+  // Only mesh line crossings split the move: one segment per cell entered
+  const xy_uint8_t c1 = bedlevel.cell_indexes(start), c2 = bedlevel.cell_indexes(end);
+  TEST_ASSERT_EQUAL(ABS(c2.x - c1.x) + ABS(c2.y - c1.y) + 1, segment_count);
+  for (uint16_t i = 0; i < segment_count; ++i)
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, bedlevel.get_z_correction(segments[i]), segments[i].z);
+}
+
+#endif // !UBL_Z_RAISE_WHEN_OFF_MESH
+
+#endif
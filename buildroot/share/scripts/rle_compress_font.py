@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# Compress the glyph bitmaps of a Marlin TFT font with RLE.
+# Input: An existing Marlin TFT font .cpp file from Marlin/src/lcd/tft/fontdata.
+# Output: The same font with each glyph's data compressed, where that makes it smaller.
+#
+# Usage: rle_compress_font.py INPUT_FILE [OUTPUT_FILE]
+#
+# A glyph is compressed when its dataSize is less than the size of the raw bitmap
+# (bytes per line * height), so compressed and raw glyphs can be mixed in a font.
+# Glyphs with more than 255 bytes of raw data are always left uncompressed, since
+# their dataSize byte only holds the low 8 bits of the size.
+# RLE data is a series of runs, each starting with a count byte:
+#   0x00-0x7F : Repeat the next byte (count + 1) times
+#   0x80-0xFF : Copy the next ((count & 0x7F) + 1) bytes
+#
+import sys, re
+
+NO_GLYPH = 0xFF
+
+def rle_encode(data):
+    out, i, n = [], 0, len(data)
+    while i < n:
+        # Length of the repeat run starting here
+        j = i + 1
+        while j < n and j - i < 128 and data[j] == data[i]: j += 1
+        if j - i >= 3:
+            out += [j - i - 1, data[i]]
+            i = j
+            continue
+        # Literal run, up to the next repeat of 3 or more
+        j = i
+        while j < n and j - i < 128:
+            if j + 2 < n and data[j] == data[j + 1] == data[j + 2]: break
+            j += 1
+        out += [0x80 | (j - i - 1)] + data[i:j]
+        i = j
+    return out
+
+def rle_decode(data, size):
+    out, i = [], 0
+    while len(out) < size:
+        count = data[i]; i += 1
+        if count & 0x80:
+            n = (count & 0x7F) + 1
+            out += data[i:i + n]; i += n
+        else:
+            out += [data[i]] * (count + 1); i += 1
+    return out
+
+def compress_font(input_file, output_file):
+    lines = open(input_file, encoding='utf-8').read().split('\n')
+    out, bpp, hiero = [], 0, False
+    in_data, total, raw_total = False, 0, 0
+    decl, size_total = 0, 0
+
+    for line in lines:
+        if not in_data:
+            if re.match(r'extern const uint8_t \w+\[\d+\] = \{', line):
+                in_data = True
+                decl, size_total = len(out), 0
+            out.append(line)
+            continue
+
+        stripped = line.strip()
+        if stripped.startswith('};'):
+            in_data = False
+            out[decl] = re.sub(r'\[\d+\]', '[%d]' % size_total, out[decl])
+            out.append(line)
+            continue
+
+        if not stripped or stripped.startswith('//'):
+            out.append(line)
+            continue
+
+        code, _, comment = stripped.partition('//')
+        values = [int(v) for v in code.split(',') if v.strip()]
+
+        if 'unifont_t' in comment:
+            fmt = values[0]
+            bpp = fmt & 0x07
+            hiero = (fmt & 0xF0) == 0xA0
+            total += len(values); raw_total += len(values); size_total += len(values)
+            out.append(line)
+            continue
+
+        if not hiero and all(v == NO_GLYPH for v in values):
+            total += len(values); raw_total += len(values); size_total += len(values)
+            out.append(line)
+            continue
+
+        prefix = values[:2] if hiero else []
+        head = values[len(prefix):len(prefix) + 6]
+        data = values[len(prefix) + 6:]
+        width, height, size = head[0], head[1], head[2]
+        raw_size = (width * bpp + 7) // 8 * height
+        if size != (raw_size & 0xFF) or len(data) != raw_size:
+            print("Glyph data doesn't match its size. Already compressed?")
+            exit(1)
+        if raw_size <= 0xFF:
+            rle = rle_encode(data)
+            assert rle_decode(rle, raw_size) == data
+            if len(rle) < raw_size:
+                head[2] = len(rle)
+                data = rle
+
+        values = prefix + head + data
+        total += len(values); raw_total += len(prefix) + 6 + raw_size; size_total += len(values)
+        out.append('  ' + ','.join(str(v) for v in values) + ',')
+
+    open(output_file, 'w', encoding='utf-8').write('\n'.join(out))
+    print("%s: %d -> %d bytes" % (input_file, raw_total, total))
+
+if len(sys.argv) <= 1 or len(sys.argv) > 3:
+    print("Usage: rle_compress_font.py INPUT_FILE [OUTPUT_FILE]")
+    exit(1)
+
+compress_font(sys.argv[1], sys.argv[2] if len(sys.argv) > 2 else sys.argv[1])
@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+Analyze binary STEP traces recorded by the LINUX HAL (STEP_LOGGING in HAL/LINUX/main.cpp).
+
+Reconstructs per-axis velocity, acceleration and jerk from the step timing,
+flags step-rate discontinuities, and compares two traces (e.g., two firmware
+builds running the same G-code) to catch motion-quality regressions.
+
+  step_trace.py trace.bin                      Summary of one trace
+  step_trace.py trace.bin --csv out.csv        Also write per-step kinematics
+  step_trace.py old.bin --compare new.bin      Compare two traces, exit 1 on regression
+
+Trace format (see HAL/LINUX/hardware/StepRecorder.h):
+  "MSTP", uint8 version, uint8 axis count, then records of
+  LEB128 delta nanoseconds + one byte (bits 0-3 stepped axes, bits 4-7 DIR states)
+"""
+
+import argparse, csv, sys
+
+AXES = 'XYZE'
+
+def read_trace(path):
+    """Return a list of (time_s, step_bits, dir_bits) records."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'MSTP':
+        raise ValueError("%s is not a STEP trace" % path)
+    version, naxes = data[4], data[5]
+    if version != 1 or naxes != len(AXES):
+        raise ValueError("%s: unsupported trace version %d with %d axes" % (path, version, naxes))
+
+    records, i, t_ns = [], 6, 0
+    while i < len(data):
+        delta, shift = 0, 0
+        while True:
+            if i >= len(data): return records      # Truncated final record
+            b = data[i]; i += 1
+            delta |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80: break
+        if i >= len(data): break
+        bits = data[i]; i += 1
+        t_ns += delta
+        records.append((t_ns * 1e-9, bits & 0x0F, bits >> 4))
+    return records
+
+class AxisTrace:
+    """Step times and derived kinematics for one axis."""
+
+    def __init__(self, name, steps_per_unit, invert):
+        self.name, self.spu, self.invert = name, steps_per_unit, invert
+        self.times, self.dirs = [], []
+        self.samples = []                             # (t, position, velocity, acceleration, jerk)
+        self.discontinuities = []                     # (t, previous rate, new rate)
+
+    def add(self, t, positive):
+        self.times.append(t)
+        self.dirs.append(positive != self.invert)
+
+    @property
+    def position(self):
+        return sum(1 if d else -1 for d in self.dirs)
+
+    def analyze(self, window, stop_gap, jump_ratio):
+        """
+        Velocity over each span of 'window' steps, then acceleration and jerk as
+        differences of samples 'window' steps apart to keep quantization noise down.
+        """
+        pos, seg, flagged = 0, [], False              # seg: (t, v, a) samples of the current move
+        for n, (t, d) in enumerate(zip(self.times, self.dirs)):
+            pos += 1 if d else -1
+
+            # A long gap or a direction change starts a new move
+            if n and ((t - self.times[n - 1]) >= stop_gap or self.dirs[n - 1] != d): seg, flagged = [], False
+            seg.append(None)
+            if len(seg) <= window: continue
+            t0 = self.times[n - window]
+            if t <= t0: continue
+
+            # Step rate of this window against the trend of the two windows before it,
+            # so steady acceleration passes and only sudden rate changes are flagged.
+            # Consecutive flagged samples are one event.
+            if jump_ratio and len(seg) > 3 * window:
+                tb, ta = self.times[n - 2 * window], self.times[n - 3 * window]
+                if t0 > tb > ta:
+                    r_a, r0, r1 = window / (tb - ta), window / (t0 - tb), window / (t - t0)
+                    jump = abs(r1 - (2 * r0 - r_a)) > jump_ratio * max(r0, r1)
+                    if jump and not flagged: self.discontinuities.append((t, r0, r1))
+                    flagged = jump
+
+            tm = (t + t0) / 2
+            v = window / (t - t0) / self.spu * (1 if d else -1)
+            a = j = None
+            prev = seg[-1 - window] if len(seg) > window else None
+            if prev and tm > prev[0]:
+                a = (v - prev[1]) / (tm - prev[0])
+                if prev[2] is not None: j = (a - prev[2]) / (tm - prev[0])
+            seg[-1] = (tm, v, a)
+            self.samples.append((tm, pos / self.spu, v, a, j))
+
+    def summary(self):
+        def peak(i):
+            vals = [abs(s[i]) for s in self.samples if s[i] is not None]
+            return max(vals) if vals else 0.0
+        return {
+            'steps': len(self.times),
+            'position': self.position / self.spu,
+            'max_velocity': peak(2),
+            'max_accel': peak(3),
+            'max_jerk': peak(4),
+            'discontinuities': len(self.discontinuities),
+            'duration': (self.times[-1] - self.times[0]) if self.times else 0.0,
+        }
+
+def analyze(path, args):
+    axes = [AxisTrace(a, args.steps_per_unit[i], a in args.invert.upper()) for i, a in enumerate(AXES)]
+    for t, steps, dirs in read_trace(path):
+        for i, axis in enumerate(axes):
+            if steps & (1 << i): axis.add(t, bool(dirs & (1 << i)))
+    for axis in axes:
+        axis.analyze(args.window, args.stop_gap, args.jump)
+    return axes
+
+def print_summary(path, axes, show):
+    print("%s:" % path)
+    print("  axis      steps   position   max_vel   max_accel      max_jerk  discont")
+    for axis in axes:
+        s = axis.summary()
+        if not s['steps']: continue
+        print("  %-4s %10d %10.3f %9.2f %11.1f %13.0f %8d" % (
+            axis.name, s['steps'], s['position'], s['max_velocity'], s['max_accel'], s['max_jerk'], s['discontinuities']))
+        for t, r0, r1 in axis.discontinuities[:show]:
+            print("         %.6fs  %.0f -> %.0f steps/s" % (t, r0, r1))
+        if len(axis.discontinuities) > show:
+            print("         ... %d more" % (len(axis.discontinuities) - show))
+
+def write_csv(path, axes):
+    with open(path, 'w', newline='') as f:
+        w = csv.writer(f)
+        w.writerow(['axis', 'time', 'position', 'velocity', 'acceleration', 'jerk'])
+        for axis in axes:
+            for t, p, v, a, j in axis.samples:
+                w.writerow([axis.name, '%.9f' % t, '%.5f' % p, '%.4f' % v,
+                            '' if a is None else '%.3f' % a, '' if j is None else '%.1f' % j])
+
+def compare(base, other, tolerance):
+    """Print differences between two analyzed traces. Return True if 'other' regressed."""
+    regressed = False
+    print("Comparison (base -> new):")
+    for a, b in zip(base, other):
+        sa, sb = a.summary(), b.summary()
+        if not sa['steps'] and not sb['steps']: continue
+        notes = []
+        if sa['steps'] != sb['steps']:
+            notes.append("step count %d -> %d" % (sa['steps'], sb['steps']))
+            regressed = True
+        if abs(sa['position'] - sb['position']) > 1e-9:
+            notes.append("end position %.4f -> %.4f" % (sa['position'], sb['position']))
+            regressed = True
+        if sb['discontinuities'] > sa['discontinuities']:
+            notes.append("discontinuities %d -> %d" % (sa['discontinuities'], sb['discontinuities']))
+            regressed = True
+        for key in ('max_velocity', 'max_accel', 'max_jerk'):
+            if sa[key] and sb[key] > sa[key] * (1 + tolerance):
+                notes.append("%s %.1f -> %.1f (+%.0f%%)" % (key, sa[key], sb[key], 100 * (sb[key] / sa[key] - 1)))
+                regressed = True
+        if sa['duration'] and abs(sb['duration'] - sa['duration']) > sa['duration'] * tolerance:
+            notes.append("duration %.3fs -> %.3fs" % (sa['duration'], sb['duration']))
+        print("  %-4s %s" % (a.name, '; '.join(notes) if notes else "same"))
+    return regressed
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('trace', help="STEP trace recorded with STEP_LOGGING")
+    parser.add_argument('--compare', metavar='TRACE', help="second trace to compare against the first")
+    parser.add_argument('--steps-per-unit', default='80,80,400,93', help="X,Y,Z,E steps per mm (default 80,80,400,93)")
+    parser.add_argument('--invert', default='', help="axes with inverted DIR, e.g. 'XE'")
+    parser.add_argument('--window', type=int, default=8, help="steps per velocity sample (default 8)")
+    parser.add_argument('--stop-gap', type=float, default=0.05, help="seconds without steps that end a move (default 0.05)")
+    parser.add_argument('--jump', type=float, default=0.25, help="step-rate change ratio flagged as a discontinuity (default 0.25, 0 disables)")
+    parser.add_argument('--tolerance', type=float, default=0.05, help="allowed peak increase when comparing (default 0.05)")
+    parser.add_argument('--show', type=int, default=5, help="discontinuities to list per axis (default 5)")
+    parser.add_argument('--csv', metavar='FILE', help="write per-sample kinematics of the first trace")
+    args = parser.parse_args()
+
+    args.steps_per_unit = [float(v) for v in args.steps_per_unit.split(',')]
+    if len(args.steps_per_unit) != len(AXES):
+        parser.error("--steps-per-unit needs %d values" % len(AXES))
+    args.window = max(1, args.window)
+
+    base = analyze(args.trace, args)
+    print_summary(args.trace, base, args.show)
+    if args.csv: write_csv(args.csv, base)
+
+    if args.compare:
+        other = analyze(args.compare, args)
+        print_summary(args.compare, other, args.show)
+        if compare(base, other, args.tolerance): sys.exit(1)
+
+if __name__ == '__main__':
+    main()